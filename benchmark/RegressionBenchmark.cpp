@@ -0,0 +1,217 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+/// RegressionBenchmark
+/// End-to-end benchmark of SCIANTIX over the regression database.
+/// Each regression/test_* case is copied in a working directory and simulated in-process (RunSimulation) several times,
+/// after a first warm-up run. For each case the median wall time, the number of time steps and the time per step are reported.
+/// The results can be written in JSON (--output) and compared with a baseline written on the same machine (--baseline, e.g. benchmark/regression_baseline.json, a local file ignored by git):
+/// the cases slower than the baseline by more than the threshold (--threshold, relative, default 0.10) are flagged as regressions,
+/// and the executable returns 1.
+///
+/// Usage: sciantix_regression_bench [--regression <dir>] [--repetitions <n>] [--filter <text>]
+///                                  [--output <file.json>] [--baseline <file.json>] [--threshold <fraction>]
+
+#include "RunSimulation.h"
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <chrono>
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+
+#ifndef SCIANTIX_REGRESSION_DIR
+#define SCIANTIX_REGRESSION_DIR "regression"
+#endif
+
+struct RegressionBenchmarkResult
+{
+	std::string regression_case;
+	long long int time_steps;
+	double wall_time_s;
+	double ns_per_step;
+	double baseline_ns_per_step;
+	bool regression;
+};
+
+static std::map<std::string, double> RegressionBenchmarkBaseline(std::string file_name)
+{
+	/// Reads the ns_per_step of each case from a JSON file written by this benchmark (one case per line).
+	std::map<std::string, double> baseline;
+	std::ifstream baseline_file(file_name);
+	if (!baseline_file.is_open())
+	{
+		std::cerr << "WARNING - sciantix_regression_bench: unable to open the baseline " << file_name << std::endl;
+		return baseline;
+	}
+
+	std::string line;
+	while (std::getline(baseline_file, line))
+	{
+		std::string::size_type case_position = line.find("\"case\": \"");
+		std::string::size_type time_position = line.find("\"ns_per_step\": ");
+		if (case_position == std::string::npos || time_position == std::string::npos) continue;
+
+		case_position += 9;
+		std::string regression_case = line.substr(case_position, line.find('"', case_position) - case_position);
+		baseline[regression_case] = atof(line.c_str() + time_position + 15);
+	}
+
+	return baseline;
+}
+
+static void RegressionBenchmarkWrite(std::ostream& output, const std::vector<RegressionBenchmarkResult>& results, int repetitions)
+{
+	output << "{\n";
+	output << "  \"benchmark\": \"sciantix_regression_bench\",\n";
+	output << "  \"repetitions\": " << repetitions << ",\n";
+	output << "  \"results\": [\n";
+	for (std::vector<RegressionBenchmarkResult>::size_type i = 0; i < results.size(); ++i)
+	{
+		output << "    {\"case\": \"" << results[i].regression_case << "\", "
+			<< "\"time_steps\": " << results[i].time_steps << ", "
+			<< std::scientific << std::setprecision(6)
+			<< "\"wall_time_s\": " << results[i].wall_time_s << ", "
+			<< std::fixed << std::setprecision(1)
+			<< "\"ns_per_step\": " << results[i].ns_per_step << "}"
+			<< (i + 1 < results.size() ? ",\n" : "\n");
+	}
+	output << "  ]\n";
+	output << "}\n";
+}
+
+int main(int argc, char* argv[])
+{
+	std::filesystem::path regression_directory(SCIANTIX_REGRESSION_DIR);
+	std::string output_name, baseline_name, filter;
+	int repetitions(3);
+	double threshold(0.10);
+
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string argument(argv[i]);
+
+		if (argument == "--regression" && i + 1 < argc)
+			regression_directory = argv[++i];
+		else if (argument == "--repetitions" && i + 1 < argc)
+			repetitions = std::max(1, atoi(argv[++i]));
+		else if (argument == "--filter" && i + 1 < argc)
+			filter = argv[++i];
+		else if (argument == "--output" && i + 1 < argc)
+			output_name = argv[++i];
+		else if (argument == "--baseline" && i + 1 < argc)
+			baseline_name = argv[++i];
+		else if (argument == "--threshold" && i + 1 < argc)
+			threshold = atof(argv[++i]);
+		else
+		{
+			std::cerr << "Usage: sciantix_regression_bench [--regression <dir>] [--repetitions <n>] [--filter <text>] "
+				<< "[--output <file.json>] [--baseline <file.json>] [--threshold <fraction>]" << std::endl;
+			return 1;
+		}
+	}
+
+	std::vector<std::string> regression_cases;
+	for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(regression_directory))
+	{
+		std::string name = entry.path().filename().string();
+		if (entry.is_directory() && name.rfind("test_", 0) == 0 && name.find(filter) != std::string::npos)
+			regression_cases.push_back(name);
+	}
+	std::sort(regression_cases.begin(), regression_cases.end());
+
+	std::map<std::string, double> baseline;
+	if (!baseline_name.empty())
+		baseline = RegressionBenchmarkBaseline(std::filesystem::absolute(baseline_name).string());
+
+	const std::filesystem::path initial_directory = std::filesystem::current_path();
+	const std::filesystem::path work_directory = std::filesystem::temp_directory_path() / "sciantix_regression_bench";
+
+	std::vector<RegressionBenchmarkResult> results;
+	bool regressions(false);
+
+	std::cerr << std::left << std::setw(48) << "Case" << std::right << std::setw(10) << "Steps" << std::setw(14) << "Wall (ms)"
+		<< std::setw(14) << "ns/step" << std::setw(14) << "Baseline" << std::setw(10) << "Change" << std::endl;
+
+	for (std::vector<std::string>::size_type c = 0; c < regression_cases.size(); ++c)
+	{
+		// The simulation runs on a copy of the input files, the regression database is not modified
+		std::filesystem::remove_all(work_directory);
+		std::filesystem::create_directories(work_directory);
+		for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(regression_directory / regression_cases[c]))
+		{
+			if (entry.path().filename().string().rfind("input_", 0) == 0)
+				std::filesystem::copy_file(entry.path(), work_directory / entry.path().filename());
+		}
+		std::filesystem::current_path(work_directory);
+
+		std::vector<double> wall_time;
+		for (int r = 0; r <= repetitions; ++r)
+		{
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			RunSimulation();
+			double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+			// The first run is a warm-up
+			if (r > 0) wall_time.push_back(elapsed);
+		}
+		std::sort(wall_time.begin(), wall_time.end());
+
+		std::filesystem::current_path(initial_directory);
+
+		RegressionBenchmarkResult result;
+		result.regression_case = regression_cases[c];
+		result.time_steps = Time_step_number + 1;
+		result.wall_time_s = wall_time[wall_time.size() / 2];
+		result.ns_per_step = result.wall_time_s * 1.0e9 / result.time_steps;
+		result.baseline_ns_per_step = baseline.count(result.regression_case) ? baseline[result.regression_case] : 0.0;
+		result.regression = result.baseline_ns_per_step > 0.0 && result.ns_per_step > (1.0 + threshold) * result.baseline_ns_per_step;
+		results.push_back(result);
+
+		if (result.regression) regressions = true;
+
+		std::cerr << std::left << std::setw(48) << result.regression_case << std::right << std::setw(10) << result.time_steps
+			<< std::fixed << std::setprecision(2) << std::setw(14) << result.wall_time_s * 1.0e3
+			<< std::setprecision(0) << std::setw(14) << result.ns_per_step;
+		if (result.baseline_ns_per_step > 0.0)
+		{
+			std::cerr << std::setw(14) << result.baseline_ns_per_step
+				<< std::setprecision(1) << std::setw(9) << 100.0 * (result.ns_per_step / result.baseline_ns_per_step - 1.0) << "%"
+				<< (result.regression ? "  REGRESSION" : "");
+		}
+		std::cerr << std::endl;
+	}
+
+	std::filesystem::remove_all(work_directory);
+
+	if (!output_name.empty())
+	{
+		std::ofstream output_file(output_name);
+		RegressionBenchmarkWrite(output_file, results, repetitions);
+	}
+	else
+		RegressionBenchmarkWrite(std::cout, results, repetitions);
+
+	if (regressions)
+		std::cerr << "Performance regressions beyond " << 100.0 * threshold << "% of the baseline." << std::endl;
+
+	return regressions ? 1 : 0;
+}
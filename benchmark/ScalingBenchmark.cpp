@@ -0,0 +1,400 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+/// ScalingBenchmark
+/// Thread-scaling and batch-throughput benchmark of SCIANTIX.
+/// The input files of the regression/test_* cases are read once, then batches of grains (grain i runs the case i % cases)
+/// are advanced for a given number of time steps (SimulationTimeStep) on 1, 2, 4, ..., P threads, each thread simulating its share of the grains.
+/// The state of a simulation is thread_local (MainVariables), hence the grains in different threads are independent.
+///   - strong scaling: the same batch of grains (--grains) is distributed on an increasing number of threads;
+///   - weak scaling: each thread simulates the same number of grains (--grains / P).
+/// For each configuration, the throughput (grains * time steps / s), the parallel efficiency with respect to one thread,
+/// the load imbalance (maximum / mean busy time of the threads), the memory of the state of a grain and the peak resident memory are reported.
+/// The final state of each grain is compared with the one of its case simulated alone in the main thread: a difference is reported as an error, and the executable returns 1.
+///
+/// Usage: sciantix_scaling_bench [--regression <dir>] [--filter <text>] [--threads <P>] [--grains <N>] [--steps <M>]
+///                               [--scaling strong|weak|both] [--output <file.json>]
+
+#include "RunSimulation.h"
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+
+#ifndef SCIANTIX_REGRESSION_DIR
+#define SCIANTIX_REGRESSION_DIR "regression"
+#endif
+
+/// Inputs of a grain, as defined by the input files (InputReading)
+struct GrainInput
+{
+	std::string regression_case;
+	int options[40];
+	double history[20];
+	double variables[300];
+	double scaling_factors[10];
+	double diffusion_modes[1000];
+	double time_end_h;
+	double time_end_s;
+	std::vector<double> time;
+	std::vector<double> temperature;
+	std::vector<double> fission_rate;
+	std::vector<double> hydrostatic_stress;
+	std::vector<double> steam_pressure;
+};
+
+struct ScalingBenchmarkResult
+{
+	std::string scaling;
+	int threads;
+	int grains;
+	long long int grain_steps;
+	double wall_time_s;
+	double throughput;
+	double efficiency;
+	double load_imbalance;
+	bool identical;
+};
+
+static GrainInput GrainInputReading(std::string regression_case)
+{
+	/// Reads the input files in the working directory, and stores the resulting inputs of the grain.
+	InputReading();
+
+	GrainInput input;
+	input.regression_case = regression_case;
+	std::copy(Sciantix_options, Sciantix_options + 40, input.options);
+	std::copy(Sciantix_history, Sciantix_history + 20, input.history);
+	std::copy(Sciantix_variables, Sciantix_variables + 300, input.variables);
+	std::copy(Sciantix_scaling_factors, Sciantix_scaling_factors + 10, input.scaling_factors);
+	std::copy(Sciantix_diffusion_modes, Sciantix_diffusion_modes + 1000, input.diffusion_modes);
+	input.time_end_h = Time_end_h;
+	input.time_end_s = Time_end_s;
+	input.time = Time_input;
+	input.temperature = Temperature_input;
+	input.fission_rate = Fissionrate_input;
+	input.hydrostatic_stress = Hydrostaticstress_input;
+	input.steam_pressure = Steampressure_input;
+
+	return input;
+}
+
+template <class T>
+static std::size_t VectorBytes(const std::vector<T>& vector)
+{
+	return sizeof(T) * vector.capacity();
+}
+
+static std::size_t GrainStateBytes(const GrainInput& input)
+{
+	/// Memory of the state of a grain: interface arrays and input history, held between two time steps,
+	/// plus the working objects rebuilt in each time step by the thread simulating the grain (variables, models, systems, materials, solver),
+	/// as left in the calling thread by the last grain simulated (capacity of the containers, the names of the objects are not included).
+	return sizeof(Sciantix_options) + sizeof(Sciantix_history) + sizeof(Sciantix_variables) + sizeof(Sciantix_scaling_factors)
+		+ sizeof(Sciantix_diffusion_modes) + sizeof(double) * 5 * input.time.size()
+		+ VectorBytes(history_variable) + VectorBytes(sciantix_variable) + VectorBytes(physics_variable) + VectorBytes(input_variable)
+		+ VectorBytes(model) + VectorBytes(model_schedule) + VectorBytes(sciantix_system) + VectorBytes(matrix) + VectorBytes(gas) + VectorBytes(material)
+		+ sizeof(solver) + sizeof(sciantix_variable_store);
+}
+
+static long long int GrainRun(const GrainInput& input, long long int steps, unsigned long long int& checksum)
+{
+	/// Simulates a grain for (at most) the given number of time steps in the calling thread,
+	/// returns the number of time steps performed and the checksum of the final state.
+	std::copy(input.options, input.options + 40, Sciantix_options);
+	std::copy(input.history, input.history + 20, Sciantix_history);
+	std::copy(input.variables, input.variables + 300, Sciantix_variables);
+	std::copy(input.scaling_factors, input.scaling_factors + 10, Sciantix_scaling_factors);
+	std::copy(input.diffusion_modes, input.diffusion_modes + 1000, Sciantix_diffusion_modes);
+
+	Time_step_number = 0;
+	Time_h = 0.0;
+	dTime_h = 0.0;
+	Time_end_h = input.time_end_h;
+	Time_s = 0.0;
+	Time_end_s = input.time_end_s;
+
+	Time_input = input.time;
+	Temperature_input = input.temperature;
+	Fissionrate_input = input.fission_rate;
+	Hydrostaticstress_input = input.hydrostatic_stress;
+	Steampressure_input = input.steam_pressure;
+	Input_history_points = int(Time_input.size());
+
+	input_variable.clear();
+	solver = Solver();
+
+	Initialization();
+
+	long long int step(0);
+	while (step < steps && Time_h <= Time_end_h)
+	{
+		++step;
+		if (!SimulationTimeStep()) break;
+	}
+
+	// FNV-1a hash of the final state
+	checksum = 14695981039346656037ull;
+	const unsigned char* bytes = reinterpret_cast<const unsigned char*>(Sciantix_variables);
+	for (std::size_t i = 0; i < sizeof(Sciantix_variables); ++i)
+		checksum = (checksum ^ bytes[i]) * 1099511628211ull;
+
+	return step;
+}
+
+static long int PeakResidentMemory()
+{
+	/// Peak resident set size (kB) of the process, from /proc/self/status (0 if not available).
+	std::ifstream status("/proc/self/status");
+	std::string line;
+	while (std::getline(status, line))
+	{
+		if (line.rfind("VmHWM:", 0) == 0)
+			return atol(line.c_str() + 6);
+	}
+	return 0;
+}
+
+static ScalingBenchmarkResult ScalingRun(const std::vector<GrainInput>& inputs, int threads, int grains, long long int steps,
+	std::vector<unsigned long long int>& checksum)
+{
+	/// Runs the batch of grains on the given number of threads (static partition of the grains, in contiguous blocks).
+	std::vector<long long int> thread_steps(threads, 0);
+	std::vector<double> thread_time(threads, 0.0);
+	checksum.assign(grains, 0);
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	std::vector<std::thread> pool;
+	for (int t = 0; t < threads; ++t)
+	{
+		pool.push_back(std::thread([&, t]()
+		{
+			// The grains do not write output.txt (Output_txt is per thread)
+			Output_txt = false;
+
+			std::chrono::steady_clock::time_point thread_start = std::chrono::steady_clock::now();
+			for (int g = int((long long int)grains * t / threads); g < int((long long int)grains * (t + 1) / threads); ++g)
+				thread_steps[t] += GrainRun(inputs[g % inputs.size()], steps, checksum[g]);
+			thread_time[t] = std::chrono::duration<double>(std::chrono::steady_clock::now() - thread_start).count();
+		}));
+	}
+	for (int t = 0; t < threads; ++t)
+		pool[t].join();
+
+	ScalingBenchmarkResult result;
+	result.threads = threads;
+	result.grains = grains;
+	result.wall_time_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	result.grain_steps = 0;
+	double mean_time(0.0), max_time(0.0);
+	for (int t = 0; t < threads; ++t)
+	{
+		result.grain_steps += thread_steps[t];
+		mean_time += thread_time[t] / threads;
+		max_time = std::max(max_time, thread_time[t]);
+	}
+	result.throughput = result.grain_steps / result.wall_time_s;
+	result.load_imbalance = (mean_time > 0.0) ? max_time / mean_time : 1.0;
+	result.efficiency = 1.0;
+	result.identical = true;
+
+	return result;
+}
+
+static void ScalingBenchmarkWrite(std::ostream& output, const std::vector<ScalingBenchmarkResult>& results, int cases, long long int steps,
+	double state_bytes, long int peak_rss_kb)
+{
+	output << "{\n";
+	output << "  \"benchmark\": \"sciantix_scaling_bench\",\n";
+	output << "  \"cases\": " << cases << ",\n";
+	output << "  \"steps_per_grain\": " << steps << ",\n";
+	output << "  \"state_bytes_per_grain\": " << std::fixed << std::setprecision(0) << state_bytes << ",\n";
+	output << "  \"peak_rss_kb\": " << peak_rss_kb << ",\n";
+	output << "  \"results\": [\n";
+	for (std::vector<ScalingBenchmarkResult>::size_type i = 0; i < results.size(); ++i)
+	{
+		output << "    {\"scaling\": \"" << results[i].scaling << "\", "
+			<< "\"threads\": " << results[i].threads << ", "
+			<< "\"grains\": " << results[i].grains << ", "
+			<< "\"grain_steps\": " << results[i].grain_steps << ", "
+			<< std::scientific << std::setprecision(6)
+			<< "\"wall_time_s\": " << results[i].wall_time_s << ", "
+			<< "\"grain_steps_per_s\": " << results[i].throughput << ", "
+			<< std::fixed << std::setprecision(3)
+			<< "\"efficiency\": " << results[i].efficiency << ", "
+			<< "\"load_imbalance\": " << results[i].load_imbalance << ", "
+			<< "\"identical\": " << (results[i].identical ? "true" : "false") << "}"
+			<< (i + 1 < results.size() ? ",\n" : "\n");
+	}
+	output << "  ]\n";
+	output << "}\n";
+}
+
+int main(int argc, char* argv[])
+{
+	std::filesystem::path regression_directory(SCIANTIX_REGRESSION_DIR);
+	std::string output_name, filter, scaling("both");
+	int max_threads = std::max(1, int(std::thread::hardware_concurrency()));
+	int grains(0);
+	long long int steps(1000);
+
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string argument(argv[i]);
+
+		if (argument == "--regression" && i + 1 < argc)
+			regression_directory = argv[++i];
+		else if (argument == "--filter" && i + 1 < argc)
+			filter = argv[++i];
+		else if (argument == "--threads" && i + 1 < argc)
+			max_threads = std::max(1, atoi(argv[++i]));
+		else if (argument == "--grains" && i + 1 < argc)
+			grains = std::max(1, atoi(argv[++i]));
+		else if (argument == "--steps" && i + 1 < argc)
+			steps = std::max(1ll, atoll(argv[++i]));
+		else if (argument == "--scaling" && i + 1 < argc && (std::string(argv[i + 1]) == "strong" || std::string(argv[i + 1]) == "weak" || std::string(argv[i + 1]) == "both"))
+			scaling = argv[++i];
+		else if (argument == "--output" && i + 1 < argc)
+			output_name = argv[++i];
+		else
+		{
+			std::cerr << "Usage: sciantix_scaling_bench [--regression <dir>] [--filter <text>] [--threads <P>] [--grains <N>] [--steps <M>] "
+				<< "[--scaling strong|weak|both] [--output <file.json>]" << std::endl;
+			return 1;
+		}
+	}
+	if (grains == 0) grains = 4 * max_threads;
+
+	std::vector<std::string> regression_cases;
+	for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(regression_directory))
+	{
+		std::string name = entry.path().filename().string();
+		if (entry.is_directory() && name.rfind("test_", 0) == 0 && name.find(filter) != std::string::npos)
+			regression_cases.push_back(name);
+	}
+	std::sort(regression_cases.begin(), regression_cases.end());
+	if (regression_cases.empty())
+	{
+		std::cerr << "ERROR - sciantix_scaling_bench: no regression case in " << regression_directory << std::endl;
+		return 1;
+	}
+
+	// The input files are read (in a copy of each case) by the main thread, the grains do not access the file system
+	const std::filesystem::path initial_directory = std::filesystem::current_path();
+	const std::filesystem::path work_directory = std::filesystem::temp_directory_path() / "sciantix_scaling_bench";
+
+	std::vector<GrainInput> inputs;
+	for (std::vector<std::string>::size_type c = 0; c < regression_cases.size(); ++c)
+	{
+		std::filesystem::remove_all(work_directory);
+		std::filesystem::create_directories(work_directory);
+		for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(regression_directory / regression_cases[c]))
+		{
+			if (entry.path().filename().string().rfind("input_", 0) == 0)
+				std::filesystem::copy_file(entry.path(), work_directory / entry.path().filename());
+		}
+		std::filesystem::current_path(work_directory);
+		inputs.push_back(GrainInputReading(regression_cases[c]));
+		std::filesystem::current_path(initial_directory);
+	}
+	std::filesystem::remove_all(work_directory);
+
+	// The reference simulations do not write output.txt (the threads of the batches set it as well)
+	Output_txt = false;
+
+	// Reference: each case is simulated once in the main thread, its final state is the reference of all the grains of the case
+	std::vector<unsigned long long int> reference_checksum(inputs.size(), 0);
+	double state_bytes(0.0);
+	for (std::vector<GrainInput>::size_type c = 0; c < inputs.size(); ++c)
+	{
+		GrainRun(inputs[c], steps, reference_checksum[c]);
+		state_bytes += double(GrainStateBytes(inputs[c])) / inputs.size();
+	}
+
+	std::vector<int> thread_counts;
+	for (int threads = 1; threads < max_threads; threads *= 2)
+		thread_counts.push_back(threads);
+	thread_counts.push_back(max_threads);
+
+	std::vector<std::string> scalings;
+	if (scaling != "weak") scalings.push_back("strong");
+	if (scaling != "strong") scalings.push_back("weak");
+
+	std::vector<ScalingBenchmarkResult> results;
+	bool identical(true);
+
+	std::cerr << std::left << std::setw(10) << "Scaling" << std::right << std::setw(10) << "Threads" << std::setw(10) << "Grains"
+		<< std::setw(14) << "Wall (s)" << std::setw(18) << "Grain-steps/s" << std::setw(12) << "Efficiency" << std::setw(12) << "Imbalance" << std::endl;
+
+	for (std::vector<std::string>::size_type s = 0; s < scalings.size(); ++s)
+	{
+		double reference_throughput(0.0);
+
+		for (std::vector<int>::size_type n = 0; n < thread_counts.size(); ++n)
+		{
+			const int threads = thread_counts[n];
+			const int batch = (scalings[s] == "strong") ? grains : threads * std::max(1, grains / max_threads);
+
+			std::vector<unsigned long long int> checksum;
+			ScalingBenchmarkResult result = ScalingRun(inputs, threads, batch, steps, checksum);
+			result.scaling = scalings[s];
+
+			if (n == 0) reference_throughput = result.throughput;
+			result.efficiency = result.throughput / (threads * reference_throughput);
+
+			// The grains of the same case are the same simulation, whatever the thread simulating them
+			for (int g = 0; g < batch; ++g)
+			{
+				if (checksum[g] != reference_checksum[g % inputs.size()])
+					result.identical = false;
+			}
+			if (!result.identical) identical = false;
+
+			results.push_back(result);
+
+			std::cerr << std::left << std::setw(10) << result.scaling << std::right << std::setw(10) << result.threads << std::setw(10) << result.grains
+				<< std::fixed << std::setprecision(3) << std::setw(14) << result.wall_time_s
+				<< std::setprecision(0) << std::setw(18) << result.throughput
+				<< std::setprecision(3) << std::setw(12) << result.efficiency << std::setw(12) << result.load_imbalance
+				<< (result.identical ? "" : "  DIFFERENT RESULTS") << std::endl;
+		}
+	}
+
+	long int peak_rss_kb = PeakResidentMemory();
+	std::cerr << "State of a grain: " << std::fixed << std::setprecision(0) << state_bytes << " bytes (mean over the cases), "
+		<< "peak resident memory: " << peak_rss_kb << " kB" << std::endl;
+
+	if (!output_name.empty())
+	{
+		std::ofstream output_file(output_name);
+		ScalingBenchmarkWrite(output_file, results, int(inputs.size()), steps, state_bytes, peak_rss_kb);
+	}
+	else
+		ScalingBenchmarkWrite(std::cout, results, int(inputs.size()), steps, state_bytes, peak_rss_kb);
+
+	if (!identical)
+		std::cerr << "ERROR - sciantix_scaling_bench: the results depend on the number of threads." << std::endl;
+
+	return identical ? 0 : 1;
+}
@@ -0,0 +1,285 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+/// SolverBenchmark
+/// Microbenchmarks of the Solver methods, to measure the optimizations of the numerical kernels in isolation.
+/// Each method is called with a representative set of parameters, taken from a call of the method in a regression case
+/// (mid-history of the case reported in the results), for at least --min-time seconds, and the measurement is repeated 5 times.
+/// The results (median and minimum ns/call, throughput in calls/s) are written in JSON on the standard output or in the --output file.
+/// The construction of the Model objects of a time step is timed as well, and the size of the objects rebuilt at each time step is reported.
+///
+/// Usage: sciantix_bench [--min-time <s>] [--output <file.json>] [--filter <method>]
+///
+/// The benchmarks are meaningful only with an optimized build (e.g., cmake -DCMAKE_BUILD_TYPE=Release).
+
+#include "Solver.h"
+#include "Model.h"
+#include "Simulation.h"
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <cstdlib>
+
+// Results of the benchmarked calls are accumulated in the sink, so that the calls cannot be optimized away
+static volatile double benchmark_sink(0.0);
+
+struct BenchmarkResult
+{
+	std::string name;
+	std::string regression_case;
+	unsigned long int calls;
+	double ns_per_call;
+	double ns_per_call_min;
+};
+
+static double BenchmarkMinTime(0.1);
+static std::string BenchmarkFilter;
+
+template <typename Kernel>
+static double BenchmarkRun(Kernel& kernel, unsigned long int calls)
+{
+	/// Time of a batch of calls, in ns.
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (unsigned long int i = 0; i < calls; ++i)
+		benchmark_sink = benchmark_sink + kernel();
+	return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+template <typename Kernel>
+static void Benchmark(std::vector<BenchmarkResult>& results, const char* name, const char* regression_case, Kernel kernel)
+{
+	if (!BenchmarkFilter.empty() && BenchmarkFilter != name) return;
+
+	const int repetitions = 5;
+
+	// Calibration: the number of calls is increased until a batch lasts at least the minimum time
+	unsigned long int calls = 1;
+	while (BenchmarkRun(kernel, calls) < BenchmarkMinTime * 1.0e9 && calls < (1ul << 40))
+		calls *= 2;
+
+	std::vector<double> ns_per_call;
+	for (int r = 0; r < repetitions; ++r)
+		ns_per_call.push_back(BenchmarkRun(kernel, calls) / calls);
+	std::sort(ns_per_call.begin(), ns_per_call.end());
+
+	BenchmarkResult result;
+	result.name = name;
+	result.regression_case = regression_case;
+	result.calls = calls;
+	result.ns_per_call = ns_per_call[repetitions / 2];
+	result.ns_per_call_min = ns_per_call[0];
+	results.push_back(result);
+
+	std::cerr << std::left << std::setw(32) << name << std::right << std::fixed << std::setprecision(2) << std::setw(12) << result.ns_per_call << " ns/call" << std::endl;
+}
+
+struct ObjectSize
+{
+	const char* name;
+	std::size_t bytes;
+};
+
+/// Size of the objects rebuilt at each time step
+static const ObjectSize object_sizes[] = {
+	{ "Model", sizeof(Model) },
+	{ "Simulation", sizeof(Simulation) },
+	{ "SciantixVariable", sizeof(SciantixVariable) },
+	{ "HistoryVariable", sizeof(HistoryVariable) },
+	{ "InputVariable", sizeof(InputVariable) },
+	{ "System", sizeof(System) },
+	{ "Gas", sizeof(Gas) },
+	{ "Matrix", sizeof(Matrix) },
+};
+
+static void BenchmarkWrite(std::ostream& output, const std::vector<BenchmarkResult>& results)
+{
+	output << "{\n";
+	output << "  \"benchmark\": \"sciantix_bench\",\n";
+#ifdef __OPTIMIZE__
+	output << "  \"optimized_build\": true,\n";
+#else
+	output << "  \"optimized_build\": false,\n";
+#endif
+	output << "  \"min_time_s\": " << BenchmarkMinTime << ",\n";
+	output << "  \"object_bytes\": {";
+	for (std::size_t i = 0; i < sizeof(object_sizes) / sizeof(object_sizes[0]); ++i)
+		output << (i ? ", " : "") << "\"" << object_sizes[i].name << "\": " << object_sizes[i].bytes;
+	output << "},\n";
+	output << "  \"results\": [\n";
+	for (std::vector<BenchmarkResult>::size_type i = 0; i < results.size(); ++i)
+	{
+		output << "    {\"name\": \"" << results[i].name << "\", \"case\": \"" << results[i].regression_case << "\", "
+			<< "\"calls\": " << results[i].calls << ", "
+			<< std::fixed << std::setprecision(3)
+			<< "\"ns_per_call\": " << results[i].ns_per_call << ", "
+			<< "\"ns_per_call_min\": " << results[i].ns_per_call_min << ", "
+			<< std::scientific << std::setprecision(6)
+			<< "\"calls_per_second\": " << 1.0e9 / results[i].ns_per_call << "}"
+			<< (i + 1 < results.size() ? ",\n" : "\n");
+	}
+	output << "  ]\n";
+	output << "}\n";
+}
+
+int main(int argc, char* argv[])
+{
+	std::string output_name;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string argument(argv[i]);
+
+		if (argument == "--min-time" && i + 1 < argc)
+			BenchmarkMinTime = atof(argv[++i]);
+		else if (argument == "--output" && i + 1 < argc)
+			output_name = argv[++i];
+		else if (argument == "--filter" && i + 1 < argc)
+			BenchmarkFilter = argv[++i];
+		else
+		{
+			std::cerr << "Usage: sciantix_bench [--min-time <s>] [--output <file.json>] [--filter <method>]" << std::endl;
+			return 1;
+		}
+	}
+
+#ifndef __OPTIMIZE__
+	std::cerr << "WARNING - sciantix_bench: not an optimized build, the timings are not representative." << std::endl;
+#endif
+
+	Solver solver;
+	std::vector<BenchmarkResult> results;
+
+	// The inputs are read from volatile variables at each call, so that the calls cannot be hoisted out of the loop
+	volatile double increment(1.98e+05);
+
+	// Xenon produced (test_Baker1977__1773K)
+	volatile double integrator_initial_value(2.32848e+25), integrator_rate(2.4e+18);
+	Benchmark(results, "Integrator", "test_Baker1977__1773K", [&]() {
+		return solver.Integrator(integrator_initial_value, integrator_rate, increment);
+	});
+
+	// Intragranular bubble concentration (test_Baker1977__1773K)
+	volatile double decay_initial_value(1.013881479e+21), decay_rate(1.362071908e-05), decay_source(1.367802104e+16);
+	Benchmark(results, "Decay", "test_Baker1977__1773K", [&]() {
+		return solver.Decay(decay_initial_value, decay_rate, decay_source, increment);
+	});
+
+	// Intergranular vacancies per bubble (test_Baker1977__1773K)
+	volatile double limited_growth_initial_value(6.258524974e+08);
+	const LimitedGrowthParameter limited_growth_parameter = { 2.487245994e+15, -3.528791036e+06 };
+	Benchmark(results, "LimitedGrowth", "test_Baker1977__1773K", [&]() {
+		return solver.LimitedGrowth(limited_growth_initial_value, limited_growth_parameter, increment);
+	});
+
+	// Intergranular bubble concentration (test_Baker1977__1773K)
+	volatile double binary_initial_value(2.452042490e+12), binary_coefficient(2.0), binary_increment(1.655049847e-14);
+	Benchmark(results, "BinaryInteraction", "test_Baker1977__1773K", [&]() {
+		return solver.BinaryInteraction(binary_initial_value, binary_coefficient, binary_increment);
+	});
+
+	// Xenon diffusion in the grain, 40 modes (test_Baker1977__1773K)
+	double spectral_modes[40] = { 0.0 };
+	const SpectralDiffusionParameter spectral_parameter = { 40.0, 2.018529674e-19, 1.343193721e-05, 3.0e+17, 0.0 };
+	Benchmark(results, "SpectralDiffusion", "test_Baker1977__1773K", [&]() {
+		return solver.SpectralDiffusion(spectral_modes, spectral_parameter, increment);
+	});
+
+	// Helium diffusion in the grain with trapping in bubbles, 40 modes (test_Talip2014_1600K)
+	double non_equilibrium_modes_solution[40] = { 0.0 };
+	double non_equilibrium_modes_bubbles[40] = { 0.0 };
+	solver.modeInitialization(40, 1.6e+24, non_equilibrium_modes_solution);
+	solver.modeInitialization(40, 8.3e+22, non_equilibrium_modes_bubbles);
+	const SpectralDiffusionNonEquilibriumParameter non_equilibrium_parameter = { 40.0, 2.775830964e-19, 0.0, 1.163939574e-07, 4.3e-05, 5.000285078e-06, 0.0, 0.0, 0.0 };
+	volatile double non_equilibrium_increment(13.464);
+	Benchmark(results, "SpectralDiffusionNonEquilibrium", "test_Talip2014_1600K", [&]() {
+		double gas_solution(0.0), gas_bubble(0.0);
+		solver.SpectralDiffusionNonEquilibrium(gas_solution, gas_bubble, non_equilibrium_modes_solution, non_equilibrium_modes_bubbles, non_equilibrium_parameter, non_equilibrium_increment);
+		return gas_solution + gas_bubble;
+	});
+
+	// First-mode system of SpectralDiffusionNonEquilibrium (test_Talip2014_1600K)
+	volatile double laplace_a0(1.0 + (1.096e-07 + 1.163939574e-07 + 4.3e-05) * 13.464), laplace_a1(0.0), laplace_a2(-1.163939574e-07 * 13.464), laplace_a3(1.0 + 4.3e-05 * 13.464);
+	volatile double laplace_b0(-1.6e+24), laplace_b1(-8.3e+22);
+	Benchmark(results, "Laplace2x2", "test_Talip2014_1600K", [&]() {
+		double A[4] = { laplace_a0, laplace_a1, laplace_a2, laplace_a3 };
+		double b[2] = { laplace_b0, laplace_b1 };
+		solver.Laplace2x2(A, b);
+		return b[0] + b[1];
+	});
+
+	// Grain growth (test_Baker1977__1773K)
+	const QuarticEquationParameter quartic_parameter = { 1.343193721e-05, 0.0, 0.0, 0.0, 1.0, -1.343193721e-05 };
+	Benchmark(results, "QuarticEquation", "test_Baker1977__1773K", [&]() {
+		return solver.QuarticEquation(quartic_parameter);
+	});
+
+	// Equilibrium stoichiometry deviation (test_UO2_oxidation_Cox_et_al_data_1473K)
+	const NewtonBlackburnParameter blackburn_parameter = { 2.116388088e-01, 1473.0, 2.607716645e-04 };
+	Benchmark(results, "NewtonBlackburn", "test_UO2_oxidation_Cox_et_al_data_1473K", [&]() {
+		return solver.NewtonBlackburn(blackburn_parameter);
+	});
+
+	// Stoichiometry deviation (test_UO2_oxidation_Cox_et_al_data_1473K)
+	volatile double langmuir_initial_value(2.116388088e-01), langmuir_increment(9.0e+03);
+	const NewtonLangmuirBasedModelParameter langmuir_parameter = { 2.727265730e-06, 2.669439781e-03, 28.0 };
+	Benchmark(results, "NewtonLangmuirBasedModel", "test_UO2_oxidation_Cox_et_al_data_1473K", [&]() {
+		return solver.NewtonLangmuirBasedModel(langmuir_initial_value, langmuir_parameter, langmuir_increment);
+	});
+
+	// Initial helium in solution, 40 modes (test_Talip2014_1600K)
+	volatile double mode_initial_condition(1.6e+24);
+	Benchmark(results, "modeInitialization", "test_Talip2014_1600K", [&]() {
+		double modes[40] = { 0.0 };
+		solver.modeInitialization(40, mode_initial_condition, modes);
+		return modes[0];
+	});
+
+	// Models of a time step: 20 Model objects, named and with their parameters, as in the model definitions (test_Baker1977__1773K)
+	std::vector<Model> models;
+	const std::string model_name("Gas diffusion - Xe in UO2"), model_reference("Speight, Nuclear Science and Engineering, 37 (1969) 180-185.");
+	ModelParameter model_parameter;
+	model_parameter.gas_diffusion = spectral_parameter;
+	Benchmark(results, "ModelConstruction", "test_Baker1977__1773K", [&]() {
+		for (int i = 0; i < 20; ++i)
+		{
+			models.emplace_back();
+			models.back().setName(model_name);
+			models.back().setRef(model_reference);
+			models.back().setParameter(model_parameter);
+		}
+		double n = double(models.size());
+		models.clear();
+		return n;
+	});
+
+	for (std::size_t i = 0; i < sizeof(object_sizes) / sizeof(object_sizes[0]); ++i)
+		std::cerr << std::left << std::setw(32) << object_sizes[i].name << std::right << std::setw(12) << object_sizes[i].bytes << " bytes" << std::endl;
+
+	if (output_name.empty())
+		BenchmarkWrite(std::cout, results);
+	else
+	{
+		std::ofstream output_file(output_name);
+		BenchmarkWrite(output_file, results);
+	}
+
+	return 0;
+}
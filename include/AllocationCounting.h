@@ -0,0 +1,59 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ALLOCATION_COUNTING_H
+#define ALLOCATION_COUNTING_H
+
+#include <string>
+#include <iostream>
+#include <fstream>
+
+/// AllocationCounting
+/// Heap allocation accounting of the instrumented build (target sciantix_allocations, compiled with SCIANTIX_ALLOCATION_COUNTING),
+/// in which the global operator new/delete are replaced by counting hooks.
+/// Each allocation is attributed to the innermost active stage (see Stage.h) or allocation site (ALLOCATION_SITE),
+/// so that, e.g., the emplace_back of the variables falls in SetVariables, the vector copies of the input history in InputInterpolation,
+/// and the strings built for the look-up of the variables (e.g., "Intergranular " + gas + " atoms per bubble") in the stage of the model using them.
+/// The instrumented executable writes allocations.txt (allocations and bytes allocated per time step and stage)
+/// and allocations_summary.txt (totals per stage). In the standard build these routines do nothing.
+
+extern thread_local bool allocation_counting_enabled;
+
+void AllocationCountingOpen(std::string file_name);
+void AllocationCountingBegin(const char* stage_name);
+void AllocationCountingEnd();
+void AllocationCountingTimeStep(long long int time_step_number);
+void AllocationCountingClose(std::string file_name);
+
+#ifdef SCIANTIX_ALLOCATION_COUNTING
+
+/// Attributes the allocations made in the enclosing scope to the site name.
+class AllocationSite
+{
+public:
+	AllocationSite(const char* site_name) { AllocationCountingBegin(site_name); }
+	~AllocationSite() { AllocationCountingEnd(); }
+};
+
+#define ALLOCATION_SITE(site_name) AllocationSite allocation_site(site_name)
+
+#else
+
+#define ALLOCATION_SITE(site_name)
+
+#endif
+
+#endif
@@ -0,0 +1,64 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <string>
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include "MainVariables.h"
+#include "TimeStepCalculation.h"
+#include "ErrorMessages.h"
+
+/// State of a simulation after a time step: everything that Sciantix() carries from one time step to the next,
+/// plus the time and the time step number. The input history is not part of it, it is read from input_history.txt.
+struct CheckpointState
+{
+	long long int time_step_number;
+	double time_h;
+	double time_s;
+	int options[40];
+	double history[20];
+	double variables[300];
+	double scaling_factors[10];
+	double diffusion_modes[1000];
+};
+
+/// Copies of the current state (thread_local MainVariables) into/from a CheckpointState
+void CheckpointSave(CheckpointState& state);
+void CheckpointRestore(const CheckpointState& state);
+
+/// Binary checkpoint file: header (format, version, size of the state), CheckpointState, FNV-1a checksum of the state.
+void CheckpointWrite(const std::string& file_name);
+void CheckpointRead(const std::string& file_name, CheckpointState& state);
+
+/// Name of the checkpoint written at the time step time_step_number by --checkpoint-interval:
+/// the time step number is appended to the name of the file, before the extension (checkpoint.bin -> checkpoint_20.bin)
+std::string CheckpointIntervalFile(const std::string& file_name, long long int time_step_number);
+
+/// Writes a checkpoint every Checkpoint_interval time steps, called after each time step (SimulationTimeStep).
+/// Each one has its own file (CheckpointIntervalFile), so that the checkpoint written at the end of the simulation
+/// (Checkpoint_file) does not replace them.
+void CheckpointTimeStep();
+
+/// Restores the state of a checkpoint and moves to the following time step of the input history.
+/// Returns false if the input history ends at the time of the checkpoint.
+bool CheckpointResume(const std::string& file_name);
+bool CheckpointResume(const CheckpointState& state);
+
+#endif
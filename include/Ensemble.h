@@ -0,0 +1,35 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ENSEMBLE_H
+#define ENSEMBLE_H
+
+#include "MainVariables.h"
+#include "SimulationStepper.h"
+#include "Sciantix.h"
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+
+/// Runs the branches listed in Ensemble_file (one directory per line) from the state of the checkpoint Resume_file,
+/// on Ensemble_threads threads (default: number of cores).
+void RunEnsemble();
+
+#endif
@@ -17,6 +17,7 @@
 #ifndef ENTITY_H
 #define ENTITY_H
 #include <string>
+#include <utility>
 
 /// Base class endowed with the member variable name, inherited by both Variable and Material classes.
 
@@ -30,7 +31,7 @@ public:
 	void setName(std::string n)
 	{
 		/// Member function to set the name of the object
-		name = n;
+		name = std::move(n);
 	}
 
 	std::string getName()
@@ -42,7 +43,7 @@ public:
 	void setRef(std::string n)
 	{
 		/// Member function to set the reference field of the object
-		reference = n;
+		reference = std::move(n);
 	}
 
 	std::string getRef()
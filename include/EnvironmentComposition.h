@@ -14,10 +14,12 @@
 //                                                                                  //
 //////////////////////////////////////////////////////////////////////////////////////
 
+#include <cmath>
 #include "SciantixVariableDeclaration.h"
 #include "HistoryVariableDeclaration.h"
 #include "ModelDeclaration.h"
 #include "MapSciantixVariable.h"
+#include "PropertyMemo.h"
 #include "MapHistoryVariable.h"
 
 void EnvironmentComposition( );
@@ -14,13 +14,35 @@
 //                                                                                  //
 //////////////////////////////////////////////////////////////////////////////////////
 
+#ifndef ERROR_MESSAGES_H
+#define ERROR_MESSAGES_H
+
 #include <string>
 #include <iostream>
 #include <cstdlib>
 #include <iomanip>
 #include <fstream>
+#include <sstream>
+#include <stdexcept>
 
 namespace ErrorMessages
 {
+	/// Error thrown, instead of writing error_log.txt and exiting, by the threads that set throw_errors (e.g., the branches of an ensemble):
+	/// what() holds the text of error_log.txt.
+	class Error : public std::runtime_error
+	{
+	public:
+		explicit Error(const std::string& message) : std::runtime_error(message) { }
+	};
+
+	extern thread_local bool throw_errors;
+
 	void Switch(std::string routine, std::string variable_name, int variable);
+	void CommandLine(std::string argument);
+	void EmptyInputHistory();
+	void InputHistory(int row, std::string problem);
+	void Checkpoint(std::string file_name, std::string problem);
+	void Ensemble(std::string file_name, std::string problem);
 };
+
+#endif
@@ -28,7 +28,10 @@
 #include "MapGas.h"
 #include "SetMatrix.h"
 
-void GasDiffusion();
+template <int iDiffusionSolver> void GasDiffusion();
+
+/// Resolution of the input option iDiffusionSolver into the corresponding GasDiffusion, once per simulation
+ModelDefinition GasDiffusionDefinition(int iDiffusionSolver);
 
 
 
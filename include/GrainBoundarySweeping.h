@@ -16,6 +16,10 @@
 
 #include "SciantixVariableDeclaration.h"
 #include "ModelDeclaration.h"
+#include "ErrorMessages.h"
 #include "MapSciantixVariable.h"
 
-void GrainBoundarySweeping();
+template <int iGrainBoundarySweeping> void GrainBoundarySweeping();
+
+/// Resolution of the input option iGrainBoundarySweeping into the corresponding GrainBoundarySweeping, once per simulation
+ModelDefinition GrainBoundarySweepingDefinition(int iGrainBoundarySweeping);
@@ -17,9 +17,13 @@
 #include "SciantixVariableDeclaration.h"
 #include "HistoryVariableDeclaration.h"
 #include "ModelDeclaration.h"
+#include "ErrorMessages.h"
 #include "SciantixScalingFactorDeclaration.h"
 
 #include "MapSciantixVariable.h"
 #include "MapHistoryVariable.h"
 
-void GrainBoundaryVenting();
+template <int iGrainBoundaryVenting> void GrainBoundaryVenting();
+
+/// Resolution of the input option iGrainBoundaryVenting into the corresponding GrainBoundaryVenting, once per simulation
+ModelDefinition GrainBoundaryVentingDefinition(int iGrainBoundaryVenting);
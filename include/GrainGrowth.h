@@ -26,4 +26,7 @@
 #include "SetVariables.h"
 #include <string>
 
-void GrainGrowth();
+template <int iGrainGrowth> void GrainGrowth();
+
+/// Resolution of the input option iGrainGrowth into the corresponding GrainGrowth, once per simulation
+ModelDefinition GrainGrowthDefinition(int iGrainGrowth);
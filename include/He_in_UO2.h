@@ -18,6 +18,7 @@
 #include "MatrixDeclaration.h"
 #include "SciantixVariableDeclaration.h"
 #include "MapSciantixVariable.h"
+#include "OptionDispatching.h"
 #include "MapMatrix.h"
 #include "SciantixScalingFactorDeclaration.h"
 
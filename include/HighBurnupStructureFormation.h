@@ -17,8 +17,12 @@
 #include "SciantixVariableDeclaration.h"
 #include "MapSciantixVariable.h"
 #include "ModelDeclaration.h"
+#include "ErrorMessages.h"
 
-void HighBurnupStructureFormation();
+template <int iHighBurnupStructureFormation> void HighBurnupStructureFormation();
+
+/// Resolution of the input option iHighBurnupStructureFormation into the corresponding HighBurnupStructureFormation, once per simulation
+ModelDefinition HighBurnupStructureFormationDefinition(int iHighBurnupStructureFormation);
 
 
 
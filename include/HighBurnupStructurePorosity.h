@@ -24,4 +24,7 @@
 #include "SystemDeclaration.h"
 #include "MapSystem.h"
 
-void HighBurnupStructurePorosity();
+template <int iHighBurnupStructurePorosity> void HighBurnupStructurePorosity();
+
+/// Resolution of the input option iHighBurnupStructurePorosity into the corresponding HighBurnupStructurePorosity, once per simulation
+ModelDefinition HighBurnupStructurePorosityDefinition(int iHighBurnupStructurePorosity);
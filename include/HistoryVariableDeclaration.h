@@ -22,6 +22,6 @@
 
 /// Extern declaration of the history_variable vector
 
-extern std::vector<HistoryVariable> history_variable;
+extern thread_local std::vector<HistoryVariable> history_variable;
 
 #endif
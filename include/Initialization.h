@@ -18,5 +18,10 @@
 #include <cmath>
 #include <ConstantNumbers.h>
 #include "MainVariables.h"
+#include "Solver.h"
 
 void Initialization();
+
+/// Derived initial values and projection on the diffusion modes of the initial conditions in Sciantix_variables
+/// (as read from input_initial_conditions.txt), also used by the library interface (SciantixLibrary.h)
+void InitialConditions(double Sciantix_variables[], double Sciantix_diffusion_modes[]);
@@ -16,4 +16,4 @@
 
 #include <vector>
 
-double InputInterpolation(double x, std::vector<double> xx, std::vector<double> yy, unsigned short int n);
+double InputInterpolation(double x, const std::vector<double>& xx, const std::vector<double>& yy, int n);
@@ -18,5 +18,11 @@
 #include <sstream>
 #include <vector>
 #include <numeric>
+#include <algorithm>
+#include <cstdlib>
 
+#include "ErrorMessages.h"
+#include "PropertyTable.h"
+
+void CommandLineReading(int argc, char* argv[]);
 void InputReading();
@@ -27,4 +27,7 @@
 #include <cmath>
 #include "ConstantNumbers.h"
 
-void InterGranularBubbleEvolution();
+template <int iGrainBoundaryBehaviour> void InterGranularBubbleEvolution();
+
+/// Resolution of the input option iGrainBoundaryBehaviour into the corresponding InterGranularBubbleEvolution, once per simulation
+ModelDefinition InterGranularBubbleEvolutionDefinition(int iGrainBoundaryBehaviour);
@@ -27,4 +27,7 @@
 #include "MapPhysicsVariable.h"
 #include "PhysicsVariableDeclaration.h"
 
-void IntraGranularBubbleEvolution();
+template <int iIntraGranularBubbleEvolution> void IntraGranularBubbleEvolution();
+
+/// Resolution of the input option iIntraGranularBubbleEvolution into the corresponding IntraGranularBubbleEvolution, once per simulation
+ModelDefinition IntraGranularBubbleEvolutionDefinition(int iIntraGranularBubbleEvolution);
@@ -21,5 +21,6 @@
 #include "SciantixScalingFactorDeclaration.h"
 #include "SciantixVariableDeclaration.h"
 #include "MapSciantixVariable.h"
+#include "OptionDispatching.h"
 
 void Kr_in_UO2();
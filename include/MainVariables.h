@@ -18,34 +18,47 @@
 #include <iostream>
 #include <fstream>
 #include <ctime>
+#include <string>
 
-extern clock_t timer, timer_time_step;
-
-extern int Sciantix_options[40];
-extern double Sciantix_history[20];
-extern double Sciantix_variables[300];
-extern double Sciantix_scaling_factors[10];
-extern double Sciantix_diffusion_modes[1000];
-
-extern long long int Time_step_number;
-extern double  Time_h, dTime_h, Time_end_h;
-extern double  Time_s, Time_end_s;
-extern double  Number_of_time_steps_per_interval;
-
-extern std::ofstream Output_file;
-extern std::ofstream Execution_file;
-
-extern int Input_history_points;
-extern int Temperature_input_points;
-extern int Fissionrate_input_points;
-extern int Hydrostaticstress_input_points;
-extern int Stempressure_input_points;
-extern std::vector<double> Time_temperature_input;
-extern std::vector<double> Time_fissionrate_input;
-extern std::vector<double> Time_hydrostaticstress_input;
-extern std::vector<double> Time_steampressure_input;
-extern std::vector<double> Time_input;
-extern std::vector<double> Temperature_input;
-extern std::vector<double> Fissionrate_input;
-extern std::vector<double> Hydrostaticstress_input;
-extern std::vector<double> Steampressure_input;
\ No newline at end of file
+// The state of a simulation is thread_local: each thread advances its own grain (e.g., sciantix_scaling_bench).
+// The command-line flags are shared by all the threads.
+extern thread_local clock_t timer, timer_time_step;
+
+extern thread_local int Sciantix_options[40];
+extern thread_local double Sciantix_history[20];
+extern thread_local double Sciantix_variables[300];
+extern thread_local double Sciantix_scaling_factors[10];
+extern thread_local double Sciantix_diffusion_modes[1000];
+
+extern thread_local long long int Time_step_number;
+extern thread_local double  Time_h, dTime_h, Time_end_h;
+extern thread_local double  Time_s, Time_end_s;
+extern thread_local double  Number_of_time_steps_per_interval;
+
+// Directory (with the trailing separator) of the input and output files of the simulation, empty for the working directory
+// (e.g., a branch of an ensemble, see Ensemble.h)
+extern thread_local std::string Simulation_directory;
+
+// Writing of output.txt at each time step: per thread, e.g., disabled by libsciantix in the threads calling it
+extern thread_local bool Output_txt;
+
+extern bool Trace_output;
+extern bool Performance_counters_output;
+extern bool Solver_output;
+extern bool Property_memo_output;
+extern bool Specialised_models;
+extern std::string Checkpoint_file;
+extern long long int Checkpoint_interval;
+extern std::string Resume_file;
+extern std::string Ensemble_file;
+extern int Ensemble_threads;
+
+extern thread_local std::ofstream Output_file;
+extern thread_local std::ofstream Execution_file;
+
+extern thread_local int Input_history_points;
+extern thread_local std::vector<double> Time_input;
+extern thread_local std::vector<double> Temperature_input;
+extern thread_local std::vector<double> Fissionrate_input;
+extern thread_local std::vector<double> Hydrostaticstress_input;
+extern thread_local std::vector<double> Steampressure_input;
\ No newline at end of file
@@ -21,7 +21,7 @@
 #include <string>
 #include "GasDeclaration.h"
 
-extern std::map<std::string, int> ga;
+extern thread_local std::map<std::string, int> ga;
 
 void MapGas();
 
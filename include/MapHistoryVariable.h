@@ -21,7 +21,7 @@
 #include <string>
 #include "HistoryVariableDeclaration.h"
 
-extern std::map<std::string, int> hv;
+extern thread_local std::map<std::string, int> hv;
 
 void MapHistoryVariable();
 
@@ -20,7 +20,7 @@
 #include <string>
 #include "InputVariableDeclaration.h"
 
-extern std::map<std::string, int> iv;
+extern thread_local std::map<std::string, int> iv;
 
 void MapInputVariable();
 
@@ -21,7 +21,7 @@
 #include <string>
 #include "MatrixDeclaration.h"
 
-extern std::map<std::string, int> sma;
+extern thread_local std::map<std::string, int> sma;
 
 void MapMatrix();
 
@@ -21,7 +21,7 @@
 #include <string>
 #include "ModelDeclaration.h"
 
-extern std::map<std::string, int> sm;
+extern thread_local std::map<std::string, int> sm;
 
 void MapModel();
 
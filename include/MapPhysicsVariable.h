@@ -21,7 +21,7 @@
 #include <string>
 #include "PhysicsVariableDeclaration.h"
 
-extern std::map<std::string, int> pv;
+extern thread_local std::map<std::string, int> pv;
 
 void MapPhysicsVariable();
 
@@ -21,7 +21,7 @@
 #include <string>
 #include "SciantixVariableDeclaration.h"
 
-extern std::map<std::string, int> sv;
+extern thread_local std::map<std::string, int> sv;
 
 void MapSciantixVariable();
 
@@ -21,7 +21,7 @@
 #include <string>
 #include "SystemDeclaration.h"
 
-extern std::map<std::string, int> sy;
+extern thread_local std::map<std::string, int> sy;
 
 void MapSystem();
 
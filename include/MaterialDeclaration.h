@@ -22,6 +22,6 @@
 
 /// Extern declaration of the material vector.
 
-extern std::vector<Material> material;
+extern thread_local std::vector<Material> material;
 
 #endif
@@ -89,7 +89,7 @@ public:
 		return ois_volume;
 	}
 
-	void setGrainBoundaryMobility(int input_value);
+	template <int input_value> void setGrainBoundaryMobility();
 
 	double getGrainBoundaryMobility()
 	{	
@@ -150,7 +150,7 @@ public:
 		return grain_boundary_thickness;
 	}
 
-	void setGrainBoundaryVacancyDiffusivity(int input_value);
+	template <int input_value> void setGrainBoundaryVacancyDiffusivity();
 	double getGrainBoundaryVacancyDiffusivity()
 	{
 		/// Member function to get the grain-boundary vacancy diffusivity (m^2/s)
@@ -211,6 +211,12 @@ public:
 		return healing_temperature_threshold;
 	}
 
+	/// Member functions to resolve, once per simulation, an input option value into the
+	/// corresponding setter. The option value is checked here, not at each time step.
+	typedef void (Matrix::*Setter)();
+	static Setter GrainBoundaryMobilitySetter(int input_value);
+	static Setter GrainBoundaryVacancyDiffusivitySetter(int input_value);
+
 	Matrix() { }
 	~Matrix() { }
 };
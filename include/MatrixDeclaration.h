@@ -20,7 +20,7 @@
 #include <vector>
 #include "Matrix.h"
 
-extern std::vector<Matrix> matrix;
+extern thread_local std::vector<Matrix> matrix;
 
 #endif
 
@@ -17,35 +17,27 @@
 #ifndef MODEL_H
 #define MODEL_H
 
-#include <vector>
-#include <string>
-#include <iterator>
-#include <map>
 #include <string>
 
-#include "HistoryVariable.h"
-#include "SciantixVariable.h"
-#include "InputVariable.h"
-#include "Matrix.h"
-#include "Gas.h"
-#include "System.h"
+#include "Entity.h"
+#include "ModelParameter.h"
 
-/// Derived class for the SCIANTIX models.
+/// Derived class for the SCIANTIX models: name, reference and parameters of the model.
+/// The state the models act upon (variables, gases, matrices, systems) is held in the global vectors, not in the Model objects.
 
-class Model : public HistoryVariable, public SciantixVariable, public InputVariable, public System
+class Model : virtual public Entity
 {
 protected:
-	std::string overview;
-	std::vector<double> parameter;
+	ModelParameter parameter;
 
 public:
 
-	void setParameter(std::vector<double> p)
+	void setParameter(const ModelParameter& p)
 	{
 		parameter = p;
 	}
 
-	std::vector<double> getParameter()
+	const ModelParameter& getParameter() const
 	{
 		return parameter;
 	}
@@ -56,4 +48,7 @@ public:
 
 };
 
+/// Routine defining a model (Model object) with the input options resolved once per simulation, at run time
+typedef void (*ModelDefinition)();
+
 #endif
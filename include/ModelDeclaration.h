@@ -20,6 +20,6 @@
 #include <vector>
 #include "Model.h"
 
-extern std::vector<Model> model;
+extern thread_local std::vector<Model> model;
 
 #endif
@@ -0,0 +1,159 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MODEL_PARAMETER_H
+#define MODEL_PARAMETER_H
+
+/// ModelParameter
+/// Fixed-size, named parameters of the models, set by the model definitions and used by the Simulation methods and the solvers.
+/// The parameters of each model are a plain struct (no heap allocation), stored in the union ModelParameter of the Model object
+/// and passed to the solvers by const reference.
+
+/// Parameters of Solver::Decay, [y' = - L y + S]
+struct DecayParameter
+{
+	double decay_rate;
+	double source_term;
+};
+
+/// Parameters of Solver::LimitedGrowth, [y' = k / y + S]
+struct LimitedGrowthParameter
+{
+	double growth_rate;
+	double source_term;
+};
+
+/// Parameters of Solver::SpectralDiffusion, [dy/dt = D div grad y + S - L y]
+struct SpectralDiffusionParameter
+{
+	double n_modes;
+	double diffusion_coefficient;
+	double domain_radius;
+	double source_term;
+	double decay_rate;
+};
+
+/// Parameters of Solver::SpectralDiffusionNonEquilibrium,
+/// [dy1/dt = D div grad y1 - g y1 + b y2 + S1 - L y1, dy2/dt = Db div grad y2 + g y1 - b y2 + S2 - L y2]
+struct SpectralDiffusionNonEquilibriumParameter
+{
+	double n_modes;
+	double diffusion_coefficient;
+	double resolution_rate;
+	double trapping_rate;
+	double decay_rate;
+	double domain_radius;
+	double source_term;
+	double source_term_bubbles;
+	double bubble_diffusivity;
+};
+
+/// Parameters of Solver::QuarticEquation, [a y^4 + b y^3 + c y^2 + d y + e = 0]
+struct QuarticEquationParameter
+{
+	double initial_value;
+	double a;
+	double b;
+	double c;
+	double d;
+	double e;
+};
+
+/// Parameters of Solver::NewtonBlackburn, [log(PO2(x)) = 2.0*log(x*(x+2.0)/(1.0-x)) + 108.0*pow(x,2.0) - 32700.0/T + 9.92]
+struct NewtonBlackburnParameter
+{
+	double stoichiometry_deviation;
+	double temperature;
+	double gap_oxygen_partial_pressure;
+};
+
+/// Parameters of Solver::NewtonLangmuirBasedModel, [y' = K (1 - beta exp(alpha y))]
+struct NewtonLangmuirBasedModelParameter
+{
+	double K;
+	double beta;
+	double alpha;
+};
+
+/// Burnup and Effective burnup
+struct BurnupParameter
+{
+	double burnup_rate; // (MWd/kg s)
+};
+
+/// Gas production
+struct GasProductionParameter
+{
+	double production_rate;
+	double time_step;
+};
+
+/// Grain-boundary sweeping
+struct GrainBoundarySweepingParameter
+{
+	double swept_volume_fraction;
+};
+
+/// Grain-boundary micro-cracking
+struct GrainBoundaryMicroCrackingParameter
+{
+	double microcracking_parameter;
+	double healing_parameter;
+};
+
+/// Grain-boundary venting, parameters of the sigmoid function of the vented fraction
+struct GrainBoundaryVentingParameter
+{
+	double screw_parameter;
+	double span_parameter;
+	double cent_parameter;
+};
+
+/// High burnup structure formation
+struct HighBurnupStructureFormationParameter
+{
+	double avrami_constant;
+	double transformation_rate;
+};
+
+/// High burnup structure porosity
+struct HighBurnupStructurePorosityParameter
+{
+	double porosity_increment;
+};
+
+/// Parameters of a Model object: each model sets and uses the member named after it
+union ModelParameter
+{
+	BurnupParameter burnup;
+	BurnupParameter effective_burnup;
+	GasProductionParameter gas_production;
+	SpectralDiffusionParameter gas_diffusion;
+	SpectralDiffusionNonEquilibriumParameter gas_diffusion_non_equilibrium;
+	QuarticEquationParameter grain_growth;
+	DecayParameter intragranular_bubble_evolution;
+	LimitedGrowthParameter intergranular_bubble_evolution;
+	GrainBoundarySweepingParameter grain_boundary_sweeping;
+	GrainBoundaryMicroCrackingParameter grain_boundary_micro_cracking;
+	GrainBoundaryVentingParameter grain_boundary_venting;
+	HighBurnupStructureFormationParameter high_burnup_structure_formation;
+	HighBurnupStructurePorosityParameter high_burnup_structure_porosity;
+	DecayParameter stoichiometry_deviation;
+	NewtonLangmuirBasedModelParameter stoichiometry_deviation_langmuir;
+	NewtonBlackburnParameter uo2_thermochemistry;
+};
+
+#endif
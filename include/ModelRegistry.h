@@ -0,0 +1,42 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MODEL_REGISTRY_H
+#define MODEL_REGISTRY_H
+
+#include <string>
+#include <vector>
+#include "SetModel.h"
+#include "HighBurnupStructurePorosity.h"
+#include "Simulation.h"
+
+/// @brief
+/// Declaration of a model of the SCIANTIX time step: the routine defining the model (Model objects), the method of Simulation solving it,
+/// the condition activating it (from the input settings), and the names of the variables it reads and writes ('*' standing for any part of a name).
+/// The routines missing for a model (e.g., GasDecay has no definition) are nullptr, as is the condition of the models always active.
+struct RegisteredModel
+{
+	const char* name;
+	void (*definition)();
+	void (Simulation::*simulation)();
+	bool (*active)();
+	std::vector<std::string> reads;
+	std::vector<std::string> writes;
+};
+
+std::vector<RegisteredModel> ModelRegistry();
+
+#endif
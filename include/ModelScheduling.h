@@ -0,0 +1,32 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MODEL_SCHEDULING_H
+#define MODEL_SCHEDULING_H
+
+#include "ModelRegistry.h"
+#include "Stage.h"
+#include "ScheduleCheck.h"
+
+extern thread_local std::vector<RegisteredModel> model_schedule;
+
+void ModelScheduling();
+
+/// Definition and solution of the scheduled models, in the order of model_schedule
+typedef void (*ModelSequence)(Simulation& sciantix_simulation);
+void ScheduledModels(Simulation& sciantix_simulation);
+
+#endif
@@ -0,0 +1,94 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MODEL_SPECIALISATION_H
+#define MODEL_SPECIALISATION_H
+
+#include "ModelScheduling.h"
+#include "MainVariables.h"
+
+/// @brief
+/// Option sets with a model sequence specialised at compile time: all the input options are template constants,
+/// so that the models disabled by the options are not even compiled in the sequence, and each model is defined and
+/// solved by a direct call. The options are listed in the order of the input_settings.txt file.
+/// The regression cases White2004 and Baker1977 (annealing) share the same settings.
+
+struct White2004OptionSet
+{
+	static const char* name() { return "White2004"; }
+
+	static const int iGrainGrowth = 1;
+	static const int iFGDiffusionCoefficient = 1;
+	static const int iDiffusionSolver = 1;
+	static const int iIntraGranularBubbleEvolution = 1;
+	static const int iResolutionRate = 1;
+	static const int iTrappingRate = 1;
+	static const int iNucleationRate = 1;
+	static const int iOutput = 1;
+	static const int iGrainBoundaryVacancyDiffusivity = 1;
+	static const int iGrainBoundaryBehaviour = 1;
+	static const int iGrainBoundaryMicroCracking = 1;
+	static const int iFuelMatrix = 0;
+	static const int iGrainBoundaryVenting = 0;
+	static const int iRadioactiveFissionGas = 0;
+	static const int iHelium = 0;
+	static const int iHeDiffusivity = 0;
+	static const int iGrainBoundarySweeping = 0;
+	static const int iHighBurnupStructureFormation = 0;
+	static const int iHBS_FGDiffusionCoefficient = 0;
+	static const int iHighBurnupStructurePorosity = 0;
+	static const int iHeliumProductionRate = 0;
+	static const int iStoichiometryDeviation = 0;
+	static const int iBubbleDiffusivity = 0;
+};
+
+/// Settings of the helium annealing cases (Talip2014)
+struct Talip2014OptionSet
+{
+	static const char* name() { return "Talip2014"; }
+
+	static const int iGrainGrowth = 2;
+	static const int iFGDiffusionCoefficient = 1;
+	static const int iDiffusionSolver = 2;
+	static const int iIntraGranularBubbleEvolution = 3;
+	static const int iResolutionRate = 3;
+	static const int iTrappingRate = 1;
+	static const int iNucleationRate = 1;
+	static const int iOutput = 1;
+	static const int iGrainBoundaryVacancyDiffusivity = 1;
+	static const int iGrainBoundaryBehaviour = 0;
+	static const int iGrainBoundaryMicroCracking = 0;
+	static const int iFuelMatrix = 0;
+	static const int iGrainBoundaryVenting = 0;
+	static const int iRadioactiveFissionGas = 0;
+	static const int iHelium = 1;
+	static const int iHeDiffusivity = 1;
+	static const int iGrainBoundarySweeping = 1;
+	static const int iHighBurnupStructureFormation = 0;
+	static const int iHBS_FGDiffusionCoefficient = 0;
+	static const int iHighBurnupStructurePorosity = 0;
+	static const int iHeliumProductionRate = 0;
+	static const int iStoichiometryDeviation = 0;
+	static const int iBubbleDiffusivity = 0;
+};
+
+/// Model sequence of the time step, and name of the option set it is specialised for ("" for the generic ScheduledModels)
+extern thread_local ModelSequence model_sequence;
+extern thread_local const char* model_specialisation;
+
+void ModelSpecialisation();
+
+#endif
@@ -0,0 +1,62 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef OPTION_DISPATCHING_H
+#define OPTION_DISPATCHING_H
+
+#include "InputVariableDeclaration.h"
+#include "MapInputVariable.h"
+#include "Matrix.h"
+#include "System.h"
+
+/// Input settings resolved once per simulation (OptionDispatching) into the functions to call at each time step,
+/// and into the flags of the variables to output.
+
+struct OptionDispatch
+{
+	// iFuelMatrix
+	void (*set_matrix)();
+	void (*set_system)();
+
+	// Properties of the matrix
+	Matrix::Setter grain_boundary_mobility;
+	Matrix::Setter grain_boundary_vacancy_diffusivity;
+
+	// Properties of the systems
+	System::Setter fission_gas_diffusivity;
+	System::Setter helium_diffusivity;
+	System::Setter bubble_diffusivity;
+	System::Setter resolution_rate;
+	System::Setter trapping_rate;
+	System::Setter nucleation_rate;
+	System::Setter helium_production_rate;
+
+	// Variables to output
+	bool output_radioactive_fission_gas;
+	bool output_venting;
+	bool output_helium;
+	bool output_cracking;
+	bool output_grain_boundary;
+	bool output_high_burnup_structure_formation;
+	bool output_stoichiometry_deviation;
+	int output_format;
+};
+
+extern thread_local OptionDispatch option_dispatch;
+
+void OptionDispatching();
+
+#endif
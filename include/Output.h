@@ -37,5 +37,9 @@
 #include "MapInputVariable.h"
 
 #include "MatrixDeclaration.h"
+#include "SolverDeclaration.h"
+#include "ModelSpecialisation.h"
+#include "OptionDispatching.h"
+#include "MainVariables.h"
 
 void Output();
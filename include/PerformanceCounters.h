@@ -0,0 +1,45 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PERFORMANCE_COUNTERS_H
+#define PERFORMANCE_COUNTERS_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+
+/// PerformanceCounters
+/// These routines sample the hardware performance counters of the processor (cycles, instructions, cache misses,
+/// branch mispredictions) through the Linux perf_event_open interface, around each stage of Sciantix() and each solver call.
+/// The counts are accumulated over the whole simulation and written in performance_counters.txt (one line per stage).
+/// Stages are nested (e.g., the solver calls inside GasDiffusion), so the counts of a stage include those of its inner stages.
+/// When the counters are multiplexed with other events, the counts of each stage are scaled by the ratio between the time enabled and the time running;
+/// the stages whose counters cannot be read are not recorded.
+/// The counters are sampled only if requested from the command line (sciantix.x --perf-counters).
+/// When the counters are not available (non-Linux systems, virtual machines, perf_event_paranoid restrictions)
+/// a warning is printed and the simulation runs without them; single counters not supported by the processor are reported as n/a.
+
+extern thread_local bool performance_counters_enabled;
+
+void PerformanceCountersOpen();
+void PerformanceCountersBegin();
+void PerformanceCountersEnd(const char* stage_name);
+void PerformanceCountersClose(std::string file_name);
+
+#endif
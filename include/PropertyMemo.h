@@ -0,0 +1,83 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PROPERTY_MEMO_H
+#define PROPERTY_MEMO_H
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iomanip>
+
+/// PropertyMemo
+/// Memoisation of the property correlations evaluated at each time step (e.g., diffusivities, resolution and trapping rates).
+/// The value of a correlation is stored together with the inputs it was evaluated with (e.g., temperature, fission rate,
+/// scaling factor): the correlation is evaluated again only if one of its inputs has changed (bit by bit), so that the results
+/// are the same of a new evaluation. Most time steps lie on plateaus of temperature and fission rate, where the inputs do not change.
+/// A few entries are stored, so that the systems evaluating the same correlation with different inputs (e.g., Xe and He) do not evict each other.
+/// PropertyMemoReport writes the hits and misses of each correlation evaluated in the simulation (with --property-memo-report).
+
+class PropertyMemoCounter
+{
+public:
+	std::string name;
+	unsigned long int hits;
+	unsigned long int misses;
+
+	PropertyMemoCounter(const char* n);
+};
+
+template <int n_inputs>
+class PropertyMemo : public PropertyMemoCounter
+{
+	static const int n_entries = 8;
+	double input[n_entries][n_inputs];
+	double value[n_entries];
+	int size;
+	int next;
+
+public:
+	bool Find(const double (&x)[n_inputs], double& v)
+	{
+		for (int e = 0; e < size; ++e)
+		{
+			if (std::memcmp(input[e], x, sizeof(x)) == 0)
+			{
+				v = value[e];
+				++hits;
+				return true;
+			}
+		}
+		++misses;
+		return false;
+	}
+
+	void Store(const double (&x)[n_inputs], double v)
+	{
+		std::memcpy(input[next], x, sizeof(x));
+		value[next] = v;
+		next = (next + 1) % n_entries;
+		if (size < n_entries) ++size;
+	}
+
+	PropertyMemo(const char* n) : PropertyMemoCounter(n), size(0), next(0) { }
+};
+
+void PropertyMemoReset();
+void PropertyMemoReport(std::string file_name);
+
+#endif
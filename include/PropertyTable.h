@@ -0,0 +1,78 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PROPERTY_TABLE_H
+#define PROPERTY_TABLE_H
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iomanip>
+#include "MainVariables.h"
+
+/// PropertyTable
+/// Tabulation of the temperature-dependent factors of the Arrhenius correlations (e.g., exp(-Q/T) in the diffusivities).
+/// By default, a PropertyTable evaluates its correlation. When sciantix is run with --property-tables <tolerance>,
+/// the tables are built at startup on a uniform grid in 1/T, refined until the relative error of the interpolation,
+/// checked at three points in each interval, is below the tolerance. The correlation is then interpolated (cubic, on four nodes)
+/// within the tabulated range of temperature, and evaluated outside of it.
+/// The fission-rate dependence of the correlations is kept analytical (e.g., Turnbull: D = D1 (T) + D2 (T) sqrt(F) + D3 F),
+/// so that a single grid in temperature is enough.
+/// The tables are shared by all the threads: they are built before any simulation is run and they are not modified afterwards.
+
+class PropertyTable
+{
+public:
+	typedef double (*Correlation)(double temperature);
+
+	std::string name;
+	Correlation correlation;
+	int intervals;
+	double max_relative_error;
+
+	double operator()(double temperature) const
+	{
+		if (value.empty()) return correlation(temperature);
+
+		const double s = (1.0 / temperature - inverse_temperature_min) * inverse_step;
+		if (!(s >= 0.0 && s < intervals)) return correlation(temperature);
+
+		const int i = int(s);
+		const double t = s - i;
+		const double* v = &value[i];
+
+		return
+			- t * (t - 1.0) * (t - 2.0) / 6.0 * v[0]
+			+ (t + 1.0) * (t - 1.0) * (t - 2.0) / 2.0 * v[1]
+			- (t + 1.0) * t * (t - 2.0) / 2.0 * v[2]
+			+ (t + 1.0) * t * (t - 1.0) / 6.0 * v[3];
+	}
+
+	bool Build(double tolerance);
+
+	PropertyTable(const char* n, Correlation c);
+
+private:
+	// value[k] = correlation at 1/T = inverse_temperature_min + (k - 1) * step, k = 0, ..., intervals + 2
+	std::vector<double> value;
+	double inverse_temperature_min;
+	double inverse_step;
+};
+
+void PropertyTables(double tolerance);
+
+#endif
@@ -13,12 +13,16 @@
 //  Authors: D. Pizzocri, G. Zullo.                                                 //
 //                                                                                  //
 //////////////////////////////////////////////////////////////////////////////////////
-#include "SciantixVariableDeclaration.h"
-#include "SciantixDiffusionModeDeclaration.h"
 
-#include "MapSciantixVariable.h"
+#ifndef RUN_SIMULATION_H
+#define RUN_SIMULATION_H
 
-#include <vector>
-#include <map>
+#include "MainVariables.h"
+#include "SimulationStepper.h"
+#include <iostream>
+#include <fstream>
+#include <ctime>
 
-void UpdateVariables(double Sciantix_variables[], double Sciantix_diffusion_modes[]);
+void RunSimulation();
+
+#endif
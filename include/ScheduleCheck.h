@@ -0,0 +1,46 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SCHEDULE_CHECK_H
+#define SCHEDULE_CHECK_H
+
+struct RegisteredModel;
+
+/// ScheduleCheck
+/// Check of the variables declared by the models of the time step (ModelRegistry), in the check build
+/// (target sciantix_schedule_check, compiled with SCIANTIX_SCHEDULE_CHECK).
+/// The accessors of the sciantix variables record the variables read and written while a scheduled model is defined and solved,
+/// and at the end of the model ScheduleCheckModel verifies that they are covered by the declaration of the model
+/// (a variable read must be declared among the reads or the writes, a variable written among the writes).
+/// An undeclared access stops the simulation with an error.
+/// The history variables (e.g., temperature, fission rate) are inputs of the time step, set before the models, and they are not checked.
+/// In the standard build the hooks are empty.
+
+#ifdef SCIANTIX_SCHEDULE_CHECK
+
+void ScheduleCheckAccess(int slot, bool write);
+void ScheduleCheckBegin();
+void ScheduleCheckModel(const RegisteredModel& registered_model);
+
+#define SCHEDULE_ACCESS(slot, write) ScheduleCheckAccess(slot, write)
+
+#else
+
+#define SCHEDULE_ACCESS(slot, write)
+
+#endif
+
+#endif
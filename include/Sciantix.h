@@ -24,9 +24,25 @@
 #include "SetModel.h"
 #include "SetMatrix.h"
 #include "SetSystem.h"
-#include "UpdateVariables.h"
 #include "Output.h"
 #include "Simulation.h"
+#include "ModelScheduling.h"
+#include "ModelSpecialisation.h"
 #include "FiguresOfMerit.h"
+#include "Stage.h"
 
+/// Time step of SCIANTIX. The elements 0-69 of Sciantix_variables are the variables exchanged with the caller:
+/// they are read at the start of the call (SetVariables) and written at its end; the other elements are not touched.
+/// The diffusion modes are evolved in place in Sciantix_diffusion_modes.
 void Sciantix(int Sciantix_options[], double Sciantix_history[], double Sciantix_variables[], double Sciantix_scaling_factors[], double Sciantix_diffusion_modes[]);
+
+/// Time step of SCIANTIX from the state in Sciantix_variables_start and Sciantix_diffusion_modes_start, which are not modified,
+/// to the state in Sciantix_variables and Sciantix_diffusion_modes (e.g., the committed and trial buffers of SciantixStateBuffer).
+/// Only the elements 0-69 of Sciantix_variables_start are read, and only the elements 0-69 of Sciantix_variables are written.
+/// Only the blocks of diffusion modes used by the simulation are copied to Sciantix_diffusion_modes (DiffusionModes),
+/// the other elements of Sciantix_diffusion_modes are left as they are.
+void Sciantix(int Sciantix_options[], double Sciantix_history[], const double Sciantix_variables_start[], double Sciantix_variables[],
+	double Sciantix_scaling_factors[], const double Sciantix_diffusion_modes_start[], double Sciantix_diffusion_modes[]);
+
+/// Clears the objects built for a time step (SetVariables, SetGas, SetMatrix, SetSystem, SetModel)
+void SciantixClear();
@@ -17,9 +17,25 @@
 #define SCIANTIX_DIFFUSION_MODES_DECLARATION
 
 #include <vector>
+#include <cstring>
 
 /// SciantixDiffusionModeDeclaration
 extern const int n_modes;
-extern double modes_initial_conditions[40*40];
+extern thread_local double* modes_initial_conditions;
+extern thread_local const double* modes_start;
+extern thread_local unsigned int modes_copied;
+
+/// Block of n_modes diffusion modes (one per gas and population, see Simulation::getDiffusionModes).
+/// When the time step starts from another array (modes_start, see SetVariables), the block is copied from it
+/// the first time it is used in the time step, so that only the modes of the simulation are copied.
+inline double* DiffusionModes(int block)
+{
+	if (modes_start != modes_initial_conditions && !(modes_copied & (1u << block)))
+	{
+		std::memcpy(modes_initial_conditions + block * n_modes, modes_start + block * n_modes, n_modes * sizeof(double));
+		modes_copied |= 1u << block;
+	}
+	return modes_initial_conditions + block * n_modes;
+}
 
 #endif
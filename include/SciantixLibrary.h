@@ -0,0 +1,77 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SCIANTIX_LIBRARY_H
+#define SCIANTIX_LIBRARY_H
+
+/// C interface of libsciantix (static and shared libraries), for fuel performance codes calling SCIANTIX in-process.
+/// A context holds the state of a grain: the input settings, the scaling factors, the sciantix variables and the diffusion modes.
+/// The arrays have the layout of the Sciantix() interface: the input settings in the order of input_settings.txt,
+/// the scaling factors in the order of input_scaling_factors.txt, the sciantix variables at the indices of Sciantix_variables.
+/// The functions returning int return 0 on success, and -1 on a wrong argument or on an error of SCIANTIX (ErrorMessages),
+/// which the library reports instead of writing error_log.txt and exiting. The library does not read or write files (no output.txt).
+/// A context can be advanced by one thread at a time; different contexts can be advanced concurrently by different threads.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SCIANTIX_OPTIONS 40
+#define SCIANTIX_SCALING_FACTORS 10
+#define SCIANTIX_VARIABLES 300
+#define SCIANTIX_DIFFUSION_MODES 1000
+
+typedef struct sciantix_context sciantix_context;
+
+/// New context, with the input settings of regression/input_settings.txt (the recommended choice for UO2), unit scaling factors
+/// and the initial conditions of the regression cases (grain radius 5 um, fuel density 10641 kg/m3, 3% U-235, the other ones 0).
+/// Returns NULL if the context cannot be created.
+sciantix_context* sciantix_create(void);
+void sciantix_destroy(sciantix_context* context);
+
+/// Input settings (n_options <= SCIANTIX_OPTIONS values) and scaling factors (n_scaling_factors <= SCIANTIX_SCALING_FACTORS values).
+/// The input settings are replaced only if each of them is in the range of its values (utilities/InputExplanation.md),
+/// and the elements after the last input setting (iBubbleDiffusivity) are 0; otherwise -1 is returned.
+int sciantix_set_options(sciantix_context* context, const int* options, int n_options);
+int sciantix_set_scaling_factors(sciantix_context* context, const double* scaling_factors, int n_scaling_factors);
+
+/// Initial state from the initial conditions (n_variables values at the indices of Sciantix_variables, as read from
+/// input_initial_conditions.txt), with the derived initial values and the projection on the diffusion modes (Initialization)
+int sciantix_set_initial_conditions(sciantix_context* context, const double* variables, int n_variables);
+
+/// Whole state, e.g., from sciantix_get_state of another context (n_variables <= SCIANTIX_VARIABLES, n_diffusion_modes <= SCIANTIX_DIFFUSION_MODES)
+int sciantix_set_state(sciantix_context* context, const double* variables, int n_variables, const double* diffusion_modes, int n_diffusion_modes);
+int sciantix_get_state(const sciantix_context* context, double* variables, int n_variables, double* diffusion_modes, int n_diffusion_modes);
+
+/// Advances the state by a time step (s), to the given temperature (K), fission rate (fiss / m3 s), hydrostatic stress (MPa)
+/// and steam pressure (atm) at the end of the time step. The values at the beginning of the time step are the ones of the previous call
+/// (of the first call, for the first time step). On an error of SCIANTIX (-1) the time step is not counted.
+int sciantix_advance(sciantix_context* context, double time_step, double temperature, double fission_rate, double hydrostatic_stress, double steam_pressure);
+
+/// Handle of the sciantix variable with the given name (e.g., "Xe released"), -1 if no variable has that name.
+/// The handle is the index of the variable in the state (sciantix_get_state), and it is valid for every context with the same input settings.
+int sciantix_variable_handle(sciantix_context* context, const char* name);
+double sciantix_get_variable(const sciantix_context* context, int handle);
+
+/// Time (s) and number of time steps advanced since the creation of the context (or the last sciantix_set_initial_conditions)
+double sciantix_get_time(const sciantix_context* context);
+long long int sciantix_get_time_step_number(const sciantix_context* context);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
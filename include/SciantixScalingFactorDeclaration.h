@@ -16,13 +16,13 @@
 
 /// SciantixScalingFactorDeclaration
 
-extern double sf_resolution_rate;
-extern double sf_trapping_rate;
-extern double sf_nucleation_rate;
-extern double sf_diffusivity;
-extern double sf_screw_parameter;
-extern double sf_span_parameter;
-extern double sf_cent_parameter;
-extern double sf_helium_production_rate;
-extern double sf_temperature;
-extern double sf_fission_rate;
\ No newline at end of file
+extern thread_local double sf_resolution_rate;
+extern thread_local double sf_trapping_rate;
+extern thread_local double sf_nucleation_rate;
+extern thread_local double sf_diffusivity;
+extern thread_local double sf_screw_parameter;
+extern thread_local double sf_span_parameter;
+extern thread_local double sf_cent_parameter;
+extern thread_local double sf_helium_production_rate;
+extern thread_local double sf_temperature;
+extern thread_local double sf_fission_rate;
\ No newline at end of file
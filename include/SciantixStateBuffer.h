@@ -0,0 +1,89 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SCIANTIX_STATE_BUFFER_H
+#define SCIANTIX_STATE_BUFFER_H
+
+#include <algorithm>
+#include "Sciantix.h"
+
+/// Committed/trial double buffer of the state of a grain (Sciantix_variables and Sciantix_diffusion_modes),
+/// for hosts that call Sciantix several times in a time step from the same start-of-step state
+/// (e.g., iterations of the thermo-mechanical solution with trial temperatures).
+/// A trial reads the committed state and writes the trial one: the committed state is never modified,
+/// so a new trial needs no restore (rollback), and accepting the last trial (commit) swaps the two buffers.
+/// A trial copies the start-of-step values of the variables (as every time step) and only the blocks of diffusion modes
+/// used by the simulation (DiffusionModes): the other blocks are never written, and hold in both buffers the values given
+/// with setCommitted.
+
+class SciantixStateBuffer
+{
+protected:
+	double variables[2][300];
+	double diffusion_modes[2][1000];
+	int committed;
+
+public:
+	void trial(int Sciantix_options[], double Sciantix_history[], double Sciantix_scaling_factors[])
+	{
+		Sciantix(Sciantix_options, Sciantix_history, variables[committed], variables[1 - committed],
+			Sciantix_scaling_factors, diffusion_modes[committed], diffusion_modes[1 - committed]);
+	}
+
+	void commit()
+	{
+		// The last trial becomes the start of the next time step
+		committed = 1 - committed;
+	}
+
+	void setCommitted(const double Sciantix_variables[], const double Sciantix_diffusion_modes[])
+	{
+		// The state is copied in both buffers, so that the modes not used by the simulation are the same in the trial state
+		for (int b = 0; b < 2; ++b)
+		{
+			std::copy(Sciantix_variables, Sciantix_variables + 300, variables[b]);
+			std::copy(Sciantix_diffusion_modes, Sciantix_diffusion_modes + 1000, diffusion_modes[b]);
+		}
+	}
+
+	const double* getCommittedVariables() const
+	{
+		return variables[committed];
+	}
+
+	const double* getCommittedDiffusionModes() const
+	{
+		return diffusion_modes[committed];
+	}
+
+	const double* getTrialVariables() const
+	{
+		return variables[1 - committed];
+	}
+
+	const double* getTrialDiffusionModes() const
+	{
+		return diffusion_modes[1 - committed];
+	}
+
+	SciantixStateBuffer(const double Sciantix_variables[], const double Sciantix_diffusion_modes[]) : committed(0)
+	{
+		setCommitted(Sciantix_variables, Sciantix_diffusion_modes);
+	}
+	~SciantixStateBuffer() { }
+};
+
+#endif
@@ -17,17 +17,112 @@
 #ifndef SCIANTIX_VARIABLE_H
 #define SCIANTIX_VARIABLE_H
 
-#include "PhysicsVariable.h"
+#include "Variable.h"
+#include "VariableStore.h"
+#include "ScheduleCheck.h"
 
-/// Derived class for sciantix variables
+extern thread_local VariableStore sciantix_variable_store;
 
-class SciantixVariable : virtual public PhysicsVariable
+/// Derived class for sciantix variables.
+/// The initial and final values live in sciantix_variable_store (slot), the object keeps the cold metadata.
+/// The variables exchanged with the caller of Sciantix() are constructed with their index in Sciantix_variables as slot.
+
+class SciantixVariable : virtual public Variable
 {
 protected:
+	std::string uom;
+	int slot;
 	bool to_output;
 
 public:
-	SciantixVariable() { }
+	void rescaleInitialValue(const double factor)
+	{
+		SCHEDULE_ACCESS(slot, true);
+		sciantix_variable_store.initial_value[slot] *= factor;
+	}
+
+	void rescaleFinalValue(const double factor)
+	{
+		SCHEDULE_ACCESS(slot, true);
+		sciantix_variable_store.final_value[slot] *= factor;
+	}
+
+	void addValue(const double v)
+	{
+		// Function to increase final_value by v
+		SCHEDULE_ACCESS(slot, true);
+		sciantix_variable_store.final_value[slot] += v;
+	}
+
+	void setUOM(std::string s)
+	{
+		uom = s;
+	}
+
+	std::string getUOM()
+	{
+		return uom;
+	}
+
+	void setConstant()
+	{
+		SCHEDULE_ACCESS(slot, true);
+		sciantix_variable_store.final_value[slot] = sciantix_variable_store.initial_value[slot];
+	}
+
+	void resetValue()
+	{
+		SCHEDULE_ACCESS(slot, true);
+		sciantix_variable_store.initial_value[slot] = sciantix_variable_store.final_value[slot];
+	}
+
+	void setFinalValue(double FinalValue)
+	{
+		SCHEDULE_ACCESS(slot, true);
+		sciantix_variable_store.final_value[slot] = FinalValue;
+	}
+
+	void setInitialValue(double InitialValue)
+	{
+		SCHEDULE_ACCESS(slot, true);
+		sciantix_variable_store.initial_value[slot] = InitialValue;
+	}
+
+	double getFinalValue()
+	{
+		SCHEDULE_ACCESS(slot, false);
+		return sciantix_variable_store.final_value[slot];
+	}
+
+	double getInitialValue()
+	{
+		SCHEDULE_ACCESS(slot, false);
+		return sciantix_variable_store.initial_value[slot];
+	}
+
+	double getIncrement()
+	{
+		SCHEDULE_ACCESS(slot, false);
+		return sciantix_variable_store.final_value[slot] - sciantix_variable_store.initial_value[slot];
+	}
+
+	void setOutput(bool io)
+	{
+		to_output = io;
+	}
+
+	bool getOutput()
+	{
+		return to_output;
+	}
+
+	int getSlot()
+	{
+		return slot;
+	}
+
+	SciantixVariable() : slot(sciantix_variable_store.allocate()), to_output(0) { }
+	explicit SciantixVariable(int bound_slot) : slot(bound_slot), to_output(0) { }
 	~SciantixVariable() { }
 };
 
@@ -22,7 +22,7 @@
 
 /// SciantixVariableDeclaration.h
 
-extern std::vector<SciantixVariable> sciantix_variable;
+extern thread_local std::vector<SciantixVariable> sciantix_variable;
 
 #endif
 
@@ -25,7 +25,13 @@
 #include <string>
 #include "GasDeclaration.h"
 #include "MapGas.h"
+#include "PropertyMemo.h"
+#include "PropertyTable.h"
 
-void SetMatrix();
+template <int iFuelMatrix> void SetMatrix();
+
+/// Resolution of the input option iFuelMatrix into the corresponding SetMatrix
+typedef void (*MatrixDefinition)();
+MatrixDefinition SetMatrixDefinition(int iFuelMatrix);
 
 
@@ -29,7 +29,13 @@
 #include "He_in_UO2.h"
 #include "Xe_in_UO2HBS.h"
 #include "Kr_in_UO2HBS.h"
+#include "PropertyMemo.h"
+#include "PropertyTable.h"
 
 #include <vector>
 
-void SetSystem();
+template <int iFuelMatrix> void SetSystem();
+
+/// Resolution of the input option iFuelMatrix into the corresponding SetSystem
+typedef void (*SystemDefinition)();
+SystemDefinition SetSystemDefinition(int iFuelMatrix);
@@ -27,5 +27,6 @@
 #include "MapSciantixVariable.h"
 #include "MapInputVariable.h"
 #include "MapPhysicsVariable.h"
+#include "OptionDispatching.h"
 
-void SetVariables(int Sciantix_options[], double Sciantix_history[], double Sciantix_variables[], double Sciantix_scaling_factors[], double Sciantix_diffusion_modes[]);
+void SetVariables(int Sciantix_options[], double Sciantix_history[], const double Sciantix_variables_start[], double Sciantix_variables[], double Sciantix_scaling_factors[], const double Sciantix_diffusion_modes_start[], double Sciantix_diffusion_modes[]);
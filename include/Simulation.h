@@ -56,7 +56,7 @@ public:
 		sciantix_variable[sv["Burnup"]].setFinalValue(
 			solver.Integrator(
 				sciantix_variable[sv["Burnup"]].getInitialValue(),
-				model[sm["Burnup"]].getParameter().at(0),
+				model[sm["Burnup"]].getParameter().burnup.burnup_rate,
 				physics_variable[pv["Time step"]].getFinalValue()
 			)
 		);
@@ -86,7 +86,7 @@ public:
 		sciantix_variable[sv["Effective burnup"]].setFinalValue(
 			solver.Integrator(
 				sciantix_variable[sv["Effective burnup"]].getInitialValue(),
-				model[sm["Effective burnup"]].getParameter().at(0),
+				model[sm["Effective burnup"]].getParameter().effective_burnup.burnup_rate,
 				physics_variable[pv["Time step"]].getFinalValue()
 			)
 		);
@@ -100,11 +100,9 @@ public:
 		/// in the HBS region.
 		/// This method is called in Sciantix.cpp after the definition of the model HighBurnupStructureFormation.
 
-		if (!int(input_variable[iv["iHighBurnupStructureFormation"]].getValue())) return;
-
 		double coefficient =
-			model[sm["High burnup structure formation"]].getParameter().at(0) *
-			model[sm["High burnup structure formation"]].getParameter().at(1) *
+			model[sm["High burnup structure formation"]].getParameter().high_burnup_structure_formation.avrami_constant *
+			model[sm["High burnup structure formation"]].getParameter().high_burnup_structure_formation.transformation_rate *
 			pow(sciantix_variable[sv["Effective burnup"]].getFinalValue(), 2.54);
 		
 		sciantix_variable[sv["Restructured volume fraction"]].setFinalValue(
@@ -129,8 +127,8 @@ public:
 			sciantix_variable[sv[sciantix_system[i].getGasName() + " produced"]].setFinalValue(
 				solver.Integrator(
 					sciantix_variable[sv[sciantix_system[i].getGasName() + " produced"]].getInitialValue(),
-					model[sm["Gas production - " + sciantix_system[i].getGasName() + " in " + matrix[0].getName()]].getParameter().at(0),
-					model[sm["Gas production - " + sciantix_system[i].getGasName() + " in " + matrix[0].getName()]].getParameter().at(1)
+					model[sm["Gas production - " + sciantix_system[i].getGasName() + " in " + matrix[0].getName()]].getParameter().gas_production.production_rate,
+					model[sm["Gas production - " + sciantix_system[i].getGasName() + " in " + matrix[0].getName()]].getParameter().gas_production.time_step
 				)
 			);
 		}
@@ -158,6 +156,7 @@ public:
 		}
 	}
 
+	template <int iDiffusionSolver, int iGrainBoundaryBehaviour>
 	void GasDiffusion()
 	{
 		/// @brief
@@ -165,14 +164,14 @@ public:
 		/// This simulation method solves the PDE for the intra-granular gas diffusion within the (ideal) spherical fuel grain.		
 		for (std::vector<System>::size_type i = 0; i != sciantix_system.size(); ++i)
 		{
-			switch (int(input_variable[iv["iDiffusionSolver"]].getValue()))
+			switch (iDiffusionSolver)
 			{
 				case 1:
 				{
 					sciantix_variable[sv[sciantix_system[i].getGasName() + " in grain"]].setFinalValue(
 						solver.SpectralDiffusion(
 							getDiffusionModes(sciantix_system[i].getGasName()),
-							model[sm["Gas diffusion - " + sciantix_system[i].getName()]].getParameter(),
+							model[sm["Gas diffusion - " + sciantix_system[i].getName()]].getParameter().gas_diffusion,
 							physics_variable[pv["Time step"]].getFinalValue()
 						)
 					);
@@ -200,7 +199,7 @@ public:
 						initial_value_bubbles,
 						getDiffusionModesSolution(sciantix_system[i].getGasName()),
 						getDiffusionModesBubbles(sciantix_system[i].getGasName()),
-						model[sm["Gas diffusion - " + sciantix_system[i].getName()]].getParameter(),
+						model[sm["Gas diffusion - " + sciantix_system[i].getName()]].getParameter().gas_diffusion_non_equilibrium,
 						physics_variable[pv["Time step"]].getFinalValue()
 					);
 
@@ -210,10 +209,6 @@ public:
 					
 					break;
 				}
-
-				default:
-					ErrorMessages::Switch("Simulation.h", "iDiffusionSolver", int(input_variable[iv["iDiffusionSolver"]].getValue()));
-					break;
 			}
 		}
 	
@@ -236,7 +231,7 @@ public:
 		 * all the gas arriving at the grain boundary is released.
 		 * 
 		 */
-		if (input_variable[iv["iGrainBoundaryBehaviour"]].getValue() == 0)
+		if (iGrainBoundaryBehaviour == 0)
 		{
 			for (std::vector<System>::size_type i = 0; i != sciantix_system.size(); ++i)
 			{
@@ -259,7 +254,7 @@ public:
 		 * 
 		 */
 		sciantix_variable[sv["Grain radius"]].setFinalValue(
-			solver.QuarticEquation(model[sm["Grain growth"]].getParameter())
+			solver.QuarticEquation(model[sm["Grain growth"]].getParameter().grain_growth)
 		);
 	}
 
@@ -271,12 +266,12 @@ public:
 		 *  
 		 */
 
-		// dN / dt = - getParameter().at(0) * N + getParameter().at(1)
+		// dN / dt = - decay_rate * N + source_term
 		sciantix_variable[sv["Intragranular bubble concentration"]].setFinalValue(
 			solver.Decay(
 				sciantix_variable[sv["Intragranular bubble concentration"]].getInitialValue(),
-				model[sm["Intragranular bubble evolution"]].getParameter().at(0),
-				model[sm["Intragranular bubble evolution"]].getParameter().at(1),
+				model[sm["Intragranular bubble evolution"]].getParameter().intragranular_bubble_evolution.decay_rate,
+				model[sm["Intragranular bubble evolution"]].getParameter().intragranular_bubble_evolution.source_term,
 				physics_variable[pv["Time step"]].getFinalValue()
 			)
 		);
@@ -325,7 +320,7 @@ public:
 		// Vacancy concentration
 		sciantix_variable[sv["Intergranular vacancies per bubble"]].setFinalValue(
 			solver.LimitedGrowth(sciantix_variable[sv["Intergranular vacancies per bubble"]].getInitialValue(),
-				model[sm["Intergranular bubble evolution"]].getParameter(),
+				model[sm["Intergranular bubble evolution"]].getParameter().intergranular_bubble_evolution,
 				physics_variable[pv["Time step"]].getFinalValue()
 			)
 		);
@@ -473,26 +468,27 @@ public:
 		);
 	}
 
+	template <int iDiffusionSolver>
 	void GrainBoundarySweeping()
 	{
 		// Sweeping of the intra-granular gas concentrations
 		// dC / df = - C
 
-		if (!input_variable[iv["Grain-boundary sweeping"]].getValue()) return;
-
 		// intra-granular gas diffusion modes
-		switch (int(input_variable[iv["iDiffusionSolver"]].getValue()))
+		switch (iDiffusionSolver)
 		{
 			case 1:
 			{
+				double* modes = DiffusionModes(6);
+
 				for (int i = 0; i < n_modes; ++i)
 				{
-					modes_initial_conditions[6 * 40 + i] =
+					modes[i] =
 						solver.Decay(
-							modes_initial_conditions[6 * 40 + i],
+							modes[i],
 							1.0,
 							0.0,
-							model[sm["Grain-boundary sweeping"]].getParameter().at(0)
+							model[sm["Grain-boundary sweeping"]].getParameter().grain_boundary_sweeping.swept_volume_fraction
 						);
 				}
 				
@@ -501,31 +497,30 @@ public:
 
 			case 2:
 			{
+				double* modes_solution = DiffusionModes(7);
+				double* modes_bubbles = DiffusionModes(8);
+
 				for (int i = 0; i < n_modes; ++i)
 				{
-					modes_initial_conditions[7 * 40 + i] =
+					modes_solution[i] =
 						solver.Decay(
-							modes_initial_conditions[7 * 40 + i],
+							modes_solution[i],
 							1.0,
 							0.0,
-							model[sm["Grain-boundary sweeping"]].getParameter().at(0)
+							model[sm["Grain-boundary sweeping"]].getParameter().grain_boundary_sweeping.swept_volume_fraction
 						);
 
-					modes_initial_conditions[8 * 40 + i] =
+					modes_bubbles[i] =
 						solver.Decay(
-							modes_initial_conditions[8 * 40 + i],
+							modes_bubbles[i],
 							1.0,
 							0.0,
-							model[sm["Grain-boundary sweeping"]].getParameter().at(0)
+							model[sm["Grain-boundary sweeping"]].getParameter().grain_boundary_sweeping.swept_volume_fraction
 						);
 				}
 
 				break;
 			}
-
-			default:
-				ErrorMessages::Switch("Simulation.h", "iDiffusionSolver", int(input_variable[iv["iDiffusionSolver"]].getValue()));
-				break;
 		}
 	}
 
@@ -534,13 +529,11 @@ public:
 		/// GrainBoundaryMicroCracking is method of simulation which executes the SCIANTIX simulation for the grain-boundary micro-cracking induced by a temperature difference. 
 		/// This method calls the related model "Grain-boundary micro-cracking", takes the model parameters and solve the model ODEs.
 
-		if (!input_variable[iv["iGrainBoundaryMicroCracking"]].getValue()) return;
-
 		// ODE for the intergranular fractional intactness: this equation accounts for the reduction of the intergranular fractional intactness following a temperature transient
 		// df / dT = - dm/dT f
 		sciantix_variable[sv["Intergranular fractional intactness"]].setFinalValue(
 			solver.Decay(sciantix_variable[sv["Intergranular fractional intactness"]].getInitialValue(),
-				model[sm["Grain-boundary micro-cracking"]].getParameter().at(0), // 1st parameter = microcracking parameter
+				model[sm["Grain-boundary micro-cracking"]].getParameter().grain_boundary_micro_cracking.microcracking_parameter,
 				0.0,
 				history_variable[hv["Temperature"]].getIncrement()
 			)
@@ -550,7 +543,7 @@ public:
 		// dFc / dT = - ( dm/dT f) Fc
 		sciantix_variable[sv["Intergranular fractional coverage"]].setFinalValue(
 			solver.Decay(sciantix_variable[sv["Intergranular fractional coverage"]].getInitialValue(),
-				model[sm["Grain-boundary micro-cracking"]].getParameter().at(0) * sciantix_variable[sv["Intergranular fractional intactness"]].getFinalValue(),
+				model[sm["Grain-boundary micro-cracking"]].getParameter().grain_boundary_micro_cracking.microcracking_parameter * sciantix_variable[sv["Intergranular fractional intactness"]].getFinalValue(),
 				0.0,
 				history_variable[hv["Temperature"]].getIncrement()
 			)
@@ -561,7 +554,7 @@ public:
 		sciantix_variable[sv["Intergranular saturation fractional coverage"]].setFinalValue(
 			solver.Decay(
 				sciantix_variable[sv["Intergranular saturation fractional coverage"]].getInitialValue(),
-				model[sm["Grain-boundary micro-cracking"]].getParameter().at(0) * sciantix_variable[sv["Intergranular fractional intactness"]].getFinalValue(),
+				model[sm["Grain-boundary micro-cracking"]].getParameter().grain_boundary_micro_cracking.microcracking_parameter * sciantix_variable[sv["Intergranular fractional intactness"]].getFinalValue(),
 				0.0,
 				history_variable[hv["Temperature"]].getIncrement()
 			)
@@ -572,8 +565,8 @@ public:
 		sciantix_variable[sv["Intergranular fractional intactness"]].setFinalValue(
 			solver.Decay(
 				sciantix_variable[sv["Intergranular fractional intactness"]].getFinalValue(),
-				model[sm["Grain-boundary micro-cracking"]].getParameter().at(1),  // 2nd parameter = healing parameter
-				model[sm["Grain-boundary micro-cracking"]].getParameter().at(1),
+				model[sm["Grain-boundary micro-cracking"]].getParameter().grain_boundary_micro_cracking.healing_parameter,
+				model[sm["Grain-boundary micro-cracking"]].getParameter().grain_boundary_micro_cracking.healing_parameter,
 				sciantix_variable[sv["Burnup"]].getIncrement()
 			)
 		);
@@ -583,7 +576,7 @@ public:
 		sciantix_variable[sv["Intergranular saturation fractional coverage"]].setFinalValue(
 			solver.Decay(
 				sciantix_variable[sv["Intergranular saturation fractional coverage"]].getFinalValue(),
-				model[sm["Grain-boundary micro-cracking"]].getParameter().at(1) * (1.0 - sciantix_variable[sv["Intergranular fractional intactness"]].getFinalValue()),
+				model[sm["Grain-boundary micro-cracking"]].getParameter().grain_boundary_micro_cracking.healing_parameter * (1.0 - sciantix_variable[sv["Intergranular fractional intactness"]].getFinalValue()),
 				0.0,
 				sciantix_variable[sv["Burnup"]].getIncrement()
 			)
@@ -641,8 +634,6 @@ public:
 
 	void GrainBoundaryVenting()
 	{
-		if (!int(input_variable[iv["iGrainBoundaryVenting"]].getValue())) return;
-
 		double sigmoid_variable;
 		sigmoid_variable = sciantix_variable[sv["Intergranular fractional coverage"]].getInitialValue() *
 			exp(1.0 - sciantix_variable[sv["Intergranular fractional intactness"]].getFinalValue());
@@ -650,10 +641,10 @@ public:
 		// Vented fraction
 		sciantix_variable[sv["Intergranular vented fraction"]].setFinalValue(
 			1.0 /
-			pow((1.0 + model[sm["Grain-boundary venting"]].getParameter().at(0) *
-				exp(-model[sm["Grain-boundary venting"]].getParameter().at(1) *
-					(sigmoid_variable - model[sm["Grain-boundary venting"]].getParameter().at(2)))),
-				(1.0 / model[sm["Grain-boundary venting"]].getParameter().at(0)))
+			pow((1.0 + model[sm["Grain-boundary venting"]].getParameter().grain_boundary_venting.screw_parameter *
+				exp(-model[sm["Grain-boundary venting"]].getParameter().grain_boundary_venting.span_parameter *
+					(sigmoid_variable - model[sm["Grain-boundary venting"]].getParameter().grain_boundary_venting.cent_parameter))),
+				(1.0 / model[sm["Grain-boundary venting"]].getParameter().grain_boundary_venting.screw_parameter))
 		);
 
 		// Venting probability
@@ -683,13 +674,11 @@ public:
 		/// HighBurnupStructurePorosity is method of simulation which executes the SCIANTIX simulation for the evolution of the porosity of a HBS matrix. 
 		/// This method takes the model parameters, solves the model ODEs and updates the matrix density coherently with the actual porosity.
 
-		if (!int(input_variable[iv["iHighBurnupStructurePorosity"]].getValue())) return;
-
 		// porosity evolution 
 		sciantix_variable[sv["HBS porosity"]].setFinalValue(
 			solver.Integrator(
 				sciantix_variable[sv["HBS porosity"]].getInitialValue(),
-				model[sm["High burnup structure porosity"]].getParameter().at(0),
+				model[sm["High burnup structure porosity"]].getParameter().high_burnup_structure_porosity.porosity_increment,
 				sciantix_variable[sv["Burnup"]].getIncrement()
 			)
 		);
@@ -701,34 +690,33 @@ public:
 	}
 
 
+template <int iStoichiometryDeviation>
  void StoichiometryDeviation()
  {
-	if (!input_variable[iv["iStoichiometryDeviation"]].getValue()) return;
-
   if(history_variable[hv["Temperature"]].getFinalValue() < 1000.0)
   {
     sciantix_variable[sv["Stoichiometry deviation"]].setConstant();
     sciantix_variable[sv["Fuel oxygen partial pressure"]].setFinalValue(0.0);
   }
 
-  else if(input_variable[iv["iStoichiometryDeviation"]].getValue() < 5)
+  else if(iStoichiometryDeviation < 5)
   {	
     sciantix_variable[sv["Stoichiometry deviation"]].setFinalValue(
       solver.Decay(
       sciantix_variable[sv["Stoichiometry deviation"]].getInitialValue(),
-          model[sm["Stoichiometry deviation"]].getParameter().at(0),
-          model[sm["Stoichiometry deviation"]].getParameter().at(1),
+          model[sm["Stoichiometry deviation"]].getParameter().stoichiometry_deviation.decay_rate,
+          model[sm["Stoichiometry deviation"]].getParameter().stoichiometry_deviation.source_term,
           physics_variable[pv["Time step"]].getFinalValue()
       )
     );
 	}
 
-	else if(input_variable[iv["iStoichiometryDeviation"]].getValue() > 4)
+	else if(iStoichiometryDeviation > 4)
 	{
 		sciantix_variable[sv["Stoichiometry deviation"]].setFinalValue(
 			solver.NewtonLangmuirBasedModel(
 				sciantix_variable[sv["Stoichiometry deviation"]].getInitialValue(),
-					model[sm["Stoichiometry deviation"]].getParameter(),
+					model[sm["Stoichiometry deviation"]].getParameter().stoichiometry_deviation_langmuir,
 					physics_variable[pv["Time step"]].getFinalValue()
 			)
 		);
@@ -744,15 +732,13 @@ public:
 
   void UO2Thermochemistry()
   {
-		if (!input_variable[iv["iStoichiometryDeviation"]].getValue()) return;
-
     if(history_variable[hv["Temperature"]].getFinalValue() < 1000.0 || sciantix_variable[sv["Gap oxygen partial pressure"]].getFinalValue() == 0)
 			sciantix_variable[sv["Equilibrium stoichiometry deviation"]].setFinalValue(0.0);
 
     else
       sciantix_variable[sv["Equilibrium stoichiometry deviation"]].setFinalValue(
         solver.NewtonBlackburn(
-        	model[sm["UO2 thermochemistry"]].getParameter()
+        	model[sm["UO2 thermochemistry"]].getParameter().uo2_thermochemistry
 				)
       );
 	}
@@ -760,55 +746,102 @@ public:
 	double* getDiffusionModes(std::string gas_name)
 	{	
 		if(gas_name == "Xe")
-			return &modes_initial_conditions[0];
+			return DiffusionModes(0);
 
 		else if(gas_name == "Kr")
-			return &modes_initial_conditions[3 * 40];
+			return DiffusionModes(3);
 
 		else if(gas_name == "He")
-			return &modes_initial_conditions[6 * 40];
+			return DiffusionModes(6);
 
 		else if(gas_name == "Xe133")
-			return &modes_initial_conditions[9 * 40];
+			return DiffusionModes(9);
 
 		else // (gas_name == "Kr85m")
-			return &modes_initial_conditions[12 * 40];
+			return DiffusionModes(12);
 	}
 
 	double* getDiffusionModesSolution(std::string gas_name)
 	{	
 		if(gas_name == "Xe")
-			return &modes_initial_conditions[1 * 40];
+			return DiffusionModes(1);
 
 		else if(gas_name == "Kr")
-			return &modes_initial_conditions[4 * 40];
+			return DiffusionModes(4);
 
 		else if(gas_name == "He")
-			return &modes_initial_conditions[7 * 40];
+			return DiffusionModes(7);
 
 		else if(gas_name == "Xe133")
-			return &modes_initial_conditions[10 * 40];
+			return DiffusionModes(10);
 
 		else // (gas_name == "Kr85m")
-			return &modes_initial_conditions[13 * 40];
+			return DiffusionModes(13);
 	}
 
 	double* getDiffusionModesBubbles(std::string gas_name)
 	{	
 		if(gas_name == "Xe")
-			return &modes_initial_conditions[2 * 40];
+			return DiffusionModes(2);
 
 		else if(gas_name == "Kr")
-			return &modes_initial_conditions[5 * 40];
+			return DiffusionModes(5);
 
 		else if(gas_name == "He")
-			return &modes_initial_conditions[8 * 40];
+			return DiffusionModes(8);
 
 		else if(gas_name == "Xe133")
-			return &modes_initial_conditions[11 * 40];
+			return DiffusionModes(11);
 
 		else // (gas_name == "Kr85m")
-			return &modes_initial_conditions[14 * 40];
+			return DiffusionModes(14);
+	}
+
+	/// Resolution of the input options into the corresponding simulation methods, once per simulation (ModelRegistry)
+	typedef void (Simulation::*Step)();
+
+	static Step GasDiffusionStep(int iDiffusionSolver, int iGrainBoundaryBehaviour)
+	{
+		switch (iDiffusionSolver)
+		{
+			case 1:
+				if (iGrainBoundaryBehaviour == 0) return &Simulation::GasDiffusion<1, 0>;
+				return &Simulation::GasDiffusion<1, 1>;
+
+			case 2:
+				if (iGrainBoundaryBehaviour == 0) return &Simulation::GasDiffusion<2, 0>;
+				return &Simulation::GasDiffusion<2, 1>;
+
+			default:
+				ErrorMessages::Switch("Simulation.h", "iDiffusionSolver", iDiffusionSolver);
+				return nullptr;
+		}
+	}
+
+	static Step GrainBoundarySweepingStep(int iDiffusionSolver)
+	{
+		switch (iDiffusionSolver)
+		{
+			case 1: return &Simulation::GrainBoundarySweeping<1>;
+			case 2: return &Simulation::GrainBoundarySweeping<2>;
+
+			default:
+				ErrorMessages::Switch("Simulation.h", "iDiffusionSolver", iDiffusionSolver);
+				return nullptr;
+		}
+	}
+
+	static Step StoichiometryDeviationStep(int iStoichiometryDeviation)
+	{
+		// The solution depends only on the kind of model: decay (iStoichiometryDeviation < 5) or Langmuir-based (> 4)
+		if (iStoichiometryDeviation > 4) return &Simulation::StoichiometryDeviation<5>;
+		return &Simulation::StoichiometryDeviation<1>;
+	}
+
+	static Step HighBurnupStructurePorosityStep(int iHighBurnupStructurePorosity)
+	{
+		if (iHighBurnupStructurePorosity == 0) return nullptr;
+		return &Simulation::HighBurnupStructurePorosity;
 	}
 
 	Simulation() {}
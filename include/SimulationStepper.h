@@ -0,0 +1,78 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SIMULATION_STEPPER_H
+#define SIMULATION_STEPPER_H
+
+#include <cstdio>
+#include "MainVariables.h"
+#include "SimulationTimeStep.h"
+#include "PropertyMemo.h"
+#include "InputReading.h"
+#include "Initialization.h"
+#include "Checkpoint.h"
+
+/// Time integration of a SCIANTIX simulation one time step at a time, for a host that interleaves the time steps
+/// with its own work, stops early or resumes later in the same process (RunSimulation runs all the time steps at once).
+/// Each time step interpolates the input history, calls Sciantix() and calculates the following time step (SimulationTimeStep).
+/// The state is the thread_local state of the calling thread (MainVariables): a thread drives one stepper at a time.
+
+class SimulationStepper
+{
+protected:
+	bool running;
+
+	// Time step number and time (h, s) of the last time step computed
+	long long int step_number;
+	double step_time_h;
+	double step_time_s;
+
+	// Reads the input files, with new input variables and solver statistics
+	void readInput();
+
+	// Sets the state of a checkpoint
+	void resume(const CheckpointState& state);
+
+public:
+	/// True when the input history is over
+	bool finished() const;
+
+	/// Computes the following time step, returns false (without computing it) when the input history is over
+	bool step();
+
+	/// Computes the time steps up to the given time (h), returns false when the input history is over
+	bool advanceTo(double time_h);
+
+	/// Time (h) of the following time step
+	double getTime() const;
+
+	/// State after the last time step computed, as in a checkpoint (it can be resumed)
+	CheckpointState getState() const;
+
+	/// Writes the files of the end of a simulation (checkpoint, reports)
+	void finish();
+
+	/// Reads the input files and sets the initial state, or the state of the checkpoint to resume (Resume_file)
+	SimulationStepper();
+
+	/// Reads the input files of the directory (Simulation_directory) and sets the state of a checkpoint already read
+	/// (e.g., the common state of the branches of an ensemble). The scaling factors of the directory, when given,
+	/// replace the ones of the checkpoint.
+	SimulationStepper(const std::string& directory, const CheckpointState& state);
+	~SimulationStepper() { }
+};
+
+#endif
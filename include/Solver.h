@@ -22,12 +22,68 @@
 #include <cmath>
 #include "InputVariable.h"
 #include "ConstantNumbers.h"
+#include "Stage.h"
+#include "ModelParameter.h"
+
+/// Convergence record of an iterative solver, accumulated over its calls (per time step or over the whole simulation).
+struct SolverConvergence
+{
+	unsigned long int calls;
+	unsigned long int iterations;
+	unsigned long int max_iterations;
+	unsigned long int not_converged;
+	double max_residual;
+};
+
+/// Iterative solvers whose convergence is recorded by the Solver class.
+enum IterativeSolver
+{
+	QUARTIC_EQUATION,
+	NEWTON_BLACKBURN,
+	NEWTON_LANGMUIR_BASED_MODEL,
+	ITERATIVE_SOLVERS
+};
 
 /// Derived class for the SCIANTIX solvers. They are communicated with models within the Simulation class.
 
 class Solver : public InputVariable
 {
 public:
+	/// Counters of the work done by the solvers: iterations of the Newton methods and diffusion modes updated by the spectral methods.
+	/// They are accumulated on the solver object and can be read (and reset) at the end of each time step, e.g., by the trace output.
+	unsigned long int newton_iterations;
+	unsigned long int diffusion_modes;
+
+	/// Convergence of the iterative solvers (iterations, final residuals, calls ended without reaching the tolerance),
+	/// in the current time step (reset by the caller at the end of each time step) and over the whole simulation.
+	SolverConvergence step_convergence[ITERATIVE_SOLVERS];
+	SolverConvergence run_convergence[ITERATIVE_SOLVERS];
+
+	static const char* IterativeSolverName(int solver_index)
+	{
+		static const char* name[ITERATIVE_SOLVERS] = { "QuarticEquation", "NewtonBlackburn", "NewtonLangmuirBasedModel" };
+		return name[solver_index];
+	}
+
+	void RecordConvergence(int solver_index, unsigned long int iterations, double residual, bool converged)
+	{
+		SolverConvergence* record[2] = { &step_convergence[solver_index], &run_convergence[solver_index] };
+
+		for (int i = 0; i < 2; ++i)
+		{
+			record[i]->calls++;
+			record[i]->iterations += iterations;
+			if (iterations > record[i]->max_iterations) record[i]->max_iterations = iterations;
+			if (!converged) record[i]->not_converged++;
+			if (std::abs(residual) > record[i]->max_residual) record[i]->max_residual = std::abs(residual);
+		}
+	}
+
+	void ResetStepConvergence()
+	{
+		for (int i = 0; i < ITERATIVE_SOLVERS; ++i)
+			step_convergence[i] = SolverConvergence();
+	}
 
 	double Integrator(double initial_value, double parameter, double increment)
 	{
@@ -36,12 +92,10 @@ public:
 		return initial_value + parameter * increment;
 	}
 
-	double LimitedGrowth(double initial_value, std::vector<double> parameter, double increment)
+	double LimitedGrowth(double initial_value, const LimitedGrowthParameter& parameter, double increment)
 	{
 		/// Solver for the ODE [y' = k / y + S]
-		// parameter[0] = growth rate
-		// parameter[1] = source term
-		return 0.5 * ((initial_value + parameter[1] * increment) + sqrt(pow(initial_value + parameter[1] * increment, 2) + 4.0 * parameter[0] * increment));
+		return 0.5 * ((initial_value + parameter.source_term * increment) + sqrt(pow(initial_value + parameter.source_term * increment, 2) + 4.0 * parameter.growth_rate * increment));
 	}
 
 	//double Decay(double initial_condition, std::vector<double> parameter, double increment)
@@ -65,20 +119,13 @@ public:
 		return initial_condition / (1.0 + interaction_coefficient * initial_condition * increment);
 	}
 
-	double SpectralDiffusion(double* initial_condition, std::vector<double> parameter, double increment)
+	double SpectralDiffusion(double* initial_condition, const SpectralDiffusionParameter& parameter, double increment)
 	{
 		/// Solver for the spatially averaged solution of the PDE [dy/dt = D div grad y + S - L y]
 		/// We apply a spectral approach in space, projecting the equation on the eigenfunctions of the laplacian operator.
 		/// We use the first order backward Euler solver in time.
 		/// The number of terms in the expansion, N, is fixed a priori.
 
-		// Parameters
-		// 0) N_modes
-		// 1) D
-		// 2) r
-		// 3) production
-		// 4) loss rate
-
 		unsigned short int n(0);
 		unsigned short int np1(1);
 
@@ -90,22 +137,27 @@ public:
 		double solution(0.0);
 		const double pi = CONSTANT_NUMBERS_H::MathConstants::pi;
 
-		diffusion_rate_coeff = pow(pi, 2) * parameter.at(1) / pow(parameter.at(2), 2);
+		StageBegin("SpectralDiffusion");
+
+		diffusion_rate_coeff = pow(pi, 2) * parameter.diffusion_coefficient / pow(parameter.domain_radius, 2);
 		projection_coeff = -2.0 * sqrt(2.0 / pi);
-		source_rate_coeff = projection_coeff * parameter.at(3);
+		source_rate_coeff = projection_coeff * parameter.source_term;
 
-		for (n = 0; n < parameter.at(0); n++)
+		for (n = 0; n < parameter.n_modes; n++)
 		{
 			np1 = n + 1;
 			const double n_coeff = pow(-1.0, np1) / np1;
 
-			diffusion_rate = diffusion_rate_coeff * pow(np1, 2) + parameter.at(4);
+			diffusion_rate = diffusion_rate_coeff * pow(np1, 2) + parameter.decay_rate;
 			source_rate = source_rate_coeff * n_coeff;
 
 			initial_condition[n] = Solver::Decay(initial_condition[n], diffusion_rate, source_rate, increment);
 
 			solution += projection_coeff * n_coeff * initial_condition[n] / ((4. / 3.) * pi);
 		}
+		diffusion_modes += n;
+
+		StageEnd("SpectralDiffusion");
 
 		return solution;
 	}
@@ -134,7 +186,7 @@ public:
 		}
 	}
 
-	void SpectralDiffusionNonEquilibrium(double& gas_solution, double& gas_bubble, double* initial_condition_gas_solution, double* initial_condition_gas_bubble, std::vector<double> parameter, double increment)
+	void SpectralDiffusionNonEquilibrium(double& gas_solution, double& gas_bubble, double* initial_condition_gas_solution, double* initial_condition_gas_bubble, const SpectralDiffusionNonEquilibriumParameter& parameter, double increment)
 	{
 		/// SpectralDiffusionNonEquilibrium
 		/// Solver for the spatially averaged solution of the systems of PDEs:
@@ -153,16 +205,6 @@ public:
 		/// We apply a spectral approach in space, projecting the equation on the eigenfunctions of the laplacian operator.
 		/// We use the first order backward Euler solver in time.
 		/// The number of terms in the expansion, N, is fixed a priori.
-		// ------------------------------------
-		// parameter --> number of modes
-		//               diffusion_coefficient (D)
-		//               resolution_rate (b)
-		//               trapping_rate (g)
-		//               decay rate (L)
-		//               domain_radius 
-		//               source_term 
-		//               source_term_bubbles
-		//							 bubble_diffusivity
 
 		unsigned short int n(0);
 		unsigned short int np1(1);
@@ -182,13 +224,13 @@ public:
 		double initial_conditions[2];
 		const double pi = CONSTANT_NUMBERS_H::MathConstants::pi;
 
-		diffusion_rate_coeff = pow(pi, 2) * parameter.at(1) / pow(parameter.at(5), 2); // pi^2 * D / a^2
-		bubble_diffusion_rate_coeff =  pow(pi, 2) * parameter.at(8) / pow(parameter.at(5), 2); // pi^2 * Db / a^2
+		diffusion_rate_coeff = pow(pi, 2) * parameter.diffusion_coefficient / pow(parameter.domain_radius, 2); // pi^2 * D / a^2
+		bubble_diffusion_rate_coeff =  pow(pi, 2) * parameter.bubble_diffusivity / pow(parameter.domain_radius, 2); // pi^2 * Db / a^2
 		projection_coeff = -2.0 * sqrt(2.0 / pi);
-		source_rate_coeff_solution = projection_coeff * parameter.at(6); // - 2 sqrt(2/pi) * S1
-		source_rate_coeff_bubbles = projection_coeff * parameter.at(7); // - 2 sqrt(2/pi) * S2
+		source_rate_coeff_solution = projection_coeff * parameter.source_term; // - 2 sqrt(2/pi) * S1
+		source_rate_coeff_bubbles = projection_coeff * parameter.source_term_bubbles; // - 2 sqrt(2/pi) * S2
 
-		for (n = 0; n < parameter.at(0); n++)
+		for (n = 0; n < parameter.n_modes; n++)
 		{
 			np1 = n + 1;
 			const double n_coeff = pow(-1.0, np1) / np1;
@@ -198,10 +240,10 @@ public:
 			source_rate_solution = source_rate_coeff_solution * n_coeff; // - 2 sqrt(2/pi) * S * (-1)^n/n
 			source_rate_bubble = source_rate_coeff_bubbles * n_coeff;
 
-			coeff_matrix[0] = 1.0 + (diffusion_rate + parameter.at(3) + parameter.at(4)) * increment; // 1 + (pi^2 * D * n^2 / a^2 + g + L) dt
-			coeff_matrix[1] = -parameter.at(2) * increment; // - b
-			coeff_matrix[2] = -parameter.at(3) * increment; // - g
-			coeff_matrix[3] = 1.0 + (bubble_diffusion_rate + parameter.at(2) + parameter.at(4)) * increment; // 1 + (pi^2 * Db * n^2 / a^2 + b + L) dt
+			coeff_matrix[0] = 1.0 + (diffusion_rate + parameter.trapping_rate + parameter.decay_rate) * increment; // 1 + (pi^2 * D * n^2 / a^2 + g + L) dt
+			coeff_matrix[1] = -parameter.resolution_rate * increment; // - b
+			coeff_matrix[2] = -parameter.trapping_rate * increment; // - g
+			coeff_matrix[3] = 1.0 + (bubble_diffusion_rate + parameter.resolution_rate + parameter.decay_rate) * increment; // 1 + (pi^2 * Db * n^2 / a^2 + b + L) dt
 			initial_conditions[0] = initial_condition_gas_solution[n] + source_rate_solution * increment;
 			initial_conditions[1] = initial_condition_gas_bubble[n] + source_rate_bubble * increment;
 
@@ -213,6 +255,7 @@ public:
 			gas_solution_solution += projection_coeff * n_coeff * initial_conditions[0] / ((4. / 3.) * pi);
 			gas_bubble_solution += projection_coeff * n_coeff * initial_conditions[1] / ((4. / 3.) * pi);
 		}
+		diffusion_modes += 2 * n;
 		gas_solution = gas_solution_solution;
 		gas_bubble = gas_bubble_solution;
 	}
@@ -234,18 +277,18 @@ public:
 	}
 
 
-  double QuarticEquation(std::vector<double> parameter)
+  double QuarticEquation(const QuarticEquationParameter& parameter)
   {
 		/**
 		 * @brief Solver for the quartic equation ax^4 + bx^3 +cx^2 +dx + e = 0
 		 * with the iterative Newton's method.
 		 * 
-		 * @param parameter.at(0) initial conditions
-		 * @param parameter.at(1) coefficient of x^4
-		 * @param parameter.at(2) coefficient of x^3
-		 * @param parameter.at(3) coefficient of x^2
-		 * @param parameter.at(4) coefficient of x^1
-		 * @param parameter.at(5) coefficient of x^0
+		 * @param parameter.initial_value initial conditions
+		 * @param parameter.a coefficient of x^4
+		 * @param parameter.b coefficient of x^3
+		 * @param parameter.c coefficient of x^2
+		 * @param parameter.d coefficient of x^1
+		 * @param parameter.e coefficient of x^0
 		 * @return x1 solution
 		 */
 
@@ -256,25 +299,33 @@ public:
     const double tol(1.0e-3);
     const unsigned short int max_iter(5);
 
-		double y0 = parameter.at(0);
-		double a = parameter.at(1);
-		double b = parameter.at(2);
-		double c = parameter.at(3);
-		double d = parameter.at(4);
-		double e = parameter.at(5);
+		double y0 = parameter.initial_value;
+		double a = parameter.a;
+		double b = parameter.b;
+		double c = parameter.c;
+		double d = parameter.d;
+		double e = parameter.e;
+
+    StageBegin("QuarticEquation");
 
     while (iter < max_iter)
     {
+      newton_iterations++;
       function = a*pow(y0, 4) + b*pow(y0, 3) + c*pow(y0, 2) + d*y0 + e;
       derivative = 4.0*a*pow(y0, 3) + 3.0*b*pow(y0, 2) + 2.0*c*y0 + d;
 
       y1 = y0 - function/derivative;
       y0 = y1;
 
-      if(function < tol) return y1;
+      if(function < tol) break;
 
       iter++;
     }
+
+    RecordConvergence(QUARTIC_EQUATION, (iter < max_iter) ? iter + 1 : iter, function, iter < max_iter);
+
+    StageEnd("QuarticEquation");
+
     return y1;
   }
 
@@ -307,7 +358,7 @@ public:
 		}
 	}
 
-  double NewtonBlackburn(std::vector<double> parameter)
+  double NewtonBlackburn(const NewtonBlackburnParameter& parameter)
   {
 		/**
 		 * @brief Solver for the non-linear equation (Blackburn's thermochemical urania model) log(PO2(x)) = 2.0*log(x*(x+2.0)/(1.0-x)) + 108.0*pow(x,2.0) - 32700.0/T + 9.92
@@ -322,11 +373,13 @@ public:
     const double tol(1.0e-3);
     const unsigned short int max_iter(50);
     
-	  double a = parameter.at(0);
-	  double b = parameter.at(1);
-	  double c = log(parameter.at(2));
+	  double a = parameter.stoichiometry_deviation;
+	  double b = parameter.temperature;
+	  double c = log(parameter.gap_oxygen_partial_pressure);
+
+    StageBegin("NewtonBlackburn");
 
-    if(parameter.at(2)==0)
+    if(parameter.gap_oxygen_partial_pressure==0)
 			std::cout << "Warning: check NewtonBlackburn solver!" << std::endl;
     
 		if(a == 0.0)
@@ -336,6 +389,7 @@ public:
 
     while (iter < max_iter)
     {
+      newton_iterations++;
       fun =  2.0*log(a*(a+2.0)/(1.0-a)) + 108.0*pow(a,2.0) - 32700.0/b + 9.92 - c;
 
       deriv = 216.0*a + 2.0*(pow(a,2.0)-2.0*a-2.0)/((a-1.0)*a*(2.0+a));
@@ -343,23 +397,24 @@ public:
       x1 = a - fun/deriv;
       a = x1;
 
-      if(abs(fun)<tol) return x1;
+      if(abs(fun)<tol) break;
 
       iter++;
     }
+
+    RecordConvergence(NEWTON_BLACKBURN, (iter < max_iter) ? iter + 1 : iter, fun, iter < max_iter);
+
+    StageEnd("NewtonBlackburn");
+
     return x1;
   }
 
-	double NewtonLangmuirBasedModel(double initial_value, std::vector<double> parameter, double increment)
+	double NewtonLangmuirBasedModel(double initial_value, const NewtonLangmuirBasedModelParameter& parameter, double increment)
 	{
 		/// Solver for the ODE [y' = K(1-beta*exp(alpha*x)))]
-		/// @param parameter[0] = K
-		/// @param parameter[1] = beta
-		/// @param parameter[2] = alpha
-
-		double K = parameter.at(0);
-		double beta = parameter.at(1);
-		double alpha = parameter.at(2);
+		double K = parameter.K;
+		double beta = parameter.beta;
+		double alpha = parameter.alpha;
 		double x0 = initial_value;
 		double x00 = initial_value;
 
@@ -370,8 +425,11 @@ public:
     const double tol(1.0e-3);
     const unsigned short int max_iter(50);
 
+    StageBegin("NewtonLangmuirBasedModel");
+
     while (iter < max_iter)
     {
+      newton_iterations++;
       fun = x0 - x00 - K * increment + K * beta * exp(alpha * x0) * increment;
 
       deriv = 1.0 + K * beta * alpha * exp(alpha * x0) * increment;
@@ -379,15 +437,20 @@ public:
       x1 = x0 - fun/deriv;
       x0 = x1;
 
-      if(abs(fun)<tol) return x1;
+      if(abs(fun)<tol) break;
 
       iter++;
     }
+
+    RecordConvergence(NEWTON_LANGMUIR_BASED_MODEL, (iter < max_iter) ? iter + 1 : iter, fun, iter < max_iter);
+
+    StageEnd("NewtonLangmuirBasedModel");
+
     return x1;
 	}
 
 
-	Solver() {}
+	Solver() : newton_iterations(0), diffusion_modes(0), step_convergence(), run_convergence() {}
 	~Solver() {}
 };
 
@@ -0,0 +1,36 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SOLVER_REPORT_H
+#define SOLVER_REPORT_H
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iomanip>
+#include "SolverDeclaration.h"
+
+/// SolverReport
+/// The iterative solvers (QuarticEquation, NewtonBlackburn, NewtonLangmuirBasedModel) stop after a fixed number of iterations,
+/// returning the last iterate also if the tolerance has not been reached.
+/// SolverConvergenceTimeStep collects, at the end of each time step, the calls of the time step that did not converge,
+/// and SolverReport writes solver_report.txt (with --solver-output) with the statistics of each solver over the whole simulation
+/// (calls, iterations, largest final residual, non-converged calls) followed by the list of the non-convergence events.
+
+void SolverConvergenceTimeStep(long long int time_step_number, double time_h);
+void SolverReport(std::string file_name);
+
+#endif
@@ -0,0 +1,49 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef STAGE_H
+#define STAGE_H
+
+#include "Trace.h"
+#include "PerformanceCounters.h"
+#include "AllocationCounting.h"
+
+/// Stage
+/// StageBegin and StageEnd delimit the stages of a SCIANTIX time step (e.g., the definition and the solution of a model in Sciantix()).
+/// They are the single entry point for the run-time instrumentation of the code (e.g., the trace output, the hardware performance counters, the heap allocation accounting).
+/// They are inlined where the stages are delimited (also in the solvers), and when no instrumentation is active they cost the check of stage_instrumentation:
+/// the instrumentation routines are called only when one of them is active.
+/// As the state of the simulation, the state of the instrumentation is thread_local: it records the stages of the thread that opened it
+/// (RunSimulation), and the simulations in other threads (e.g., the branches of an ensemble, the grains of sciantix_scaling_bench) are not instrumented.
+
+/// True when an instrumentation is active, updated by StageInstrumentationUpdate when an instrumentation is opened or closed
+extern thread_local bool stage_instrumentation;
+void StageInstrumentationUpdate();
+
+void StageInstrumentationBegin(const char* stage_name);
+void StageInstrumentationEnd(const char* stage_name);
+
+inline void StageBegin(const char* stage_name)
+{
+	if (stage_instrumentation) StageInstrumentationBegin(stage_name);
+}
+
+inline void StageEnd(const char* stage_name)
+{
+	if (stage_instrumentation) StageInstrumentationEnd(stage_name);
+}
+
+#endif
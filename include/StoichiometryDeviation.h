@@ -14,7 +14,9 @@
 //                                                                                  //
 //////////////////////////////////////////////////////////////////////////////////////
 
+#include <cmath>
 #include "ModelDeclaration.h"
+#include "ErrorMessages.h"
 #include "InputVariableDeclaration.h"
 #include "SciantixVariableDeclaration.h"
 #include "MapSciantixVariable.h"
@@ -22,4 +24,7 @@
 #include "MapHistoryVariable.h"
 #include "ConstantNumbers.h"
 
-void StoichiometryDeviation( );
+template <int iStoichiometryDeviation> void StoichiometryDeviation();
+
+/// Resolution of the input option iStoichiometryDeviation into the corresponding StoichiometryDeviation, once per simulation
+ModelDefinition StoichiometryDeviationDefinition(int iStoichiometryDeviation);
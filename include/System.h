@@ -94,21 +94,21 @@ public:
 		volume_in_lattice = v;
 	}
 	
-	void setBubbleDiffusivity(int input_value);
+	template <int input_value> void setBubbleDiffusivity();
 	double getBubbleDiffusivity()
 	{
 		/// Member function to get the bubble diffusivity of the isotope in the fuel matrix
 		return bubble_diffusivity;	
 	}
 
-	void setHeliumDiffusivity(int input_value);
+	template <int input_value> void setHeliumDiffusivity();
 	double getHeliumDiffusivity()
 	{
 		/// Member function to get the bubble diffusivity of the isotope in the fuel matrix
 		return diffusivity;	
 	}
 
-	void setFissionGasDiffusivity(int input_value);	
+	template <int input_value> void setFissionGasDiffusivity();	
 	double getFissionGasDiffusivity()
 	{
 		/// Member function to get the diffusivity of the isotope in the fuel matrix
@@ -127,21 +127,21 @@ public:
 		return henry_constant;
 	}
 
-	void setResolutionRate(int input_value);
+	template <int input_value> void setResolutionRate();
 	double getResolutionRate()
 	{
 		/// Member function to get the value of the resolution rate of the isotope from fuel matrix nanobubbles
 		return resolution_rate;
 	}
 
-	void setTrappingRate(int input_value);
+	template <int input_value> void setTrappingRate();
 	double getTrappingRate()
 	{
 		/// Member function to get the value of the trapping rate of the isotope in the fuel matrix nanobubbles
 		return trapping_rate;
 	}
 
-	void setNucleationRate(int input_value);
+	template <int input_value> void setNucleationRate();
 	double getNucleationRate()
 	{
 		return nucleation_rate;
@@ -157,7 +157,7 @@ public:
 		return pore_nucleation_rate;
 	}
 
-	void setProductionRate(int input_value);
+	template <int input_value> void setProductionRate();
 	double getProductionRate()
 	{
     /** @fn double getProductionRate()
@@ -168,6 +168,20 @@ public:
 		return production_rate;
 	}
 
+	/// Sets the properties of the fission gas systems, shared by the systems defined in the same time step (SetSystem)
+	void setFissionGasProperties();
+
+	/// Member functions to resolve, once per simulation, an input option value into the
+	/// corresponding setter. The option value is checked here, not at each time step.
+	typedef void (System::*Setter)();
+	static Setter BubbleDiffusivitySetter(int input_value);
+	static Setter HeliumDiffusivitySetter(int input_value);
+	static Setter FissionGasDiffusivitySetter(int input_value);
+	static Setter ResolutionRateSetter(int input_value);
+	static Setter TrappingRateSetter(int input_value);
+	static Setter NucleationRateSetter(int input_value);
+	static Setter ProductionRateSetter(int input_value);
+
 	System() { }
 	~System() { }
 };
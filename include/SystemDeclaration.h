@@ -21,6 +21,6 @@
 #include "ConstantNumbers.h"
 #include "System.h"
 
-extern std::vector<System> sciantix_system;
+extern thread_local std::vector<System> sciantix_system;
 
 #endif
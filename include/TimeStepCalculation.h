@@ -14,5 +14,6 @@
 //                                                                                  //
 //////////////////////////////////////////////////////////////////////////////////////
 #include "MainVariables.h"
+#include <algorithm>
 
 double TimeStepCalculation();
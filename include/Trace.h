@@ -0,0 +1,42 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <string>
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+
+/// Trace
+/// These routines write a trace.json file in the Chrome trace-event format (JSON object format),
+/// which can be opened directly in Perfetto (https://ui.perfetto.dev) or in chrome://tracing.
+/// Each time step and each stage of Sciantix() is recorded as a duration event ("B"/"E" pair),
+/// while scalar quantities (e.g., time step size, solver iterations) are recorded as counter events ("C").
+/// The trace is written only if requested from the command line (sciantix.x --trace).
+
+extern thread_local bool trace_enabled;
+
+void TraceOpen(std::string file_name);
+void TraceBegin(const char* name);
+void TraceEnd(const char* name);
+void TraceCounter(const char* name, double value);
+void TraceClose();
+
+#endif
@@ -17,6 +17,7 @@
 #include "MatrixDeclaration.h"
 #include "SciantixVariableDeclaration.h"
 #include "MapSciantixVariable.h"
+#include "OptionDispatching.h"
 #include "HistoryVariableDeclaration.h"
 #include "MapHistoryVariable.h"
 #include "ModelDeclaration.h"
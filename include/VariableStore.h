@@ -0,0 +1,123 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+#ifndef VARIABLE_STORE_H
+#define VARIABLE_STORE_H
+
+#include <vector>
+#include <cstring>
+
+/// Structure-of-arrays storage of the initial and final values of a family of variables.
+/// Each variable owns a slot in two contiguous arrays; names, units and output flags stay in the variable objects.
+/// Holding a whole family constant, or advancing it to the next time step, is a single memcpy.
+///
+/// The first n_bound slots can be bound to arrays of the caller (bind): they are the variables exchanged with the caller,
+/// at their index in the arrays, and the other variables take the following slots. The initial values of the bound slots
+/// are copied when binding, their final values are copied back by unbind; the other slots are never copied to the caller.
+
+class VariableStore
+{
+public:
+	double* initial_value;
+	double* final_value;
+
+protected:
+	std::vector<double> initial_buffer;
+	std::vector<double> final_buffer;
+	double* bound_values;
+	int n_slots;
+	int n_bound;
+
+	void reserve(int slots)
+	{
+		// The buffers grow with the variables, and are kept from one time step to the next
+		if (int(final_buffer.size()) < slots)
+		{
+			int capacity = final_buffer.empty() ? 64 : int(final_buffer.size());
+			while (capacity < slots)
+				capacity *= 2;
+
+			initial_buffer.resize(capacity);
+			final_buffer.resize(capacity);
+			initial_value = initial_buffer.data();
+			final_value = final_buffer.data();
+		}
+	}
+
+public:
+	void bind(const double* initial_values, double* values, int bound)
+	{
+		// The initial values of the bound variables are copied from initial_values, which may be values itself
+		reserve(bound);
+
+		bound_values = values;
+		n_bound = bound;
+		n_slots = bound;
+
+		std::memcpy(initial_value, initial_values, n_bound * sizeof(double));
+	}
+
+	void bind(double* values, int bound)
+	{
+		bind(values, values, bound);
+	}
+
+	void unbind()
+	{
+		// The final values of the bound variables are copied back to the array of the caller
+		if (bound_values)
+			std::memcpy(bound_values, final_value, n_bound * sizeof(double));
+
+		bound_values = 0;
+	}
+
+	int allocate()
+	{
+		// Slot of a variable not exchanged with the caller
+		reserve(n_slots + 1);
+
+		initial_value[n_slots] = 0.0;
+		final_value[n_slots] = 0.0;
+
+		return n_slots++;
+	}
+
+	int bound() const
+	{
+		return n_bound;
+	}
+
+	int size() const
+	{
+		return n_slots;
+	}
+
+	void setConstant()
+	{
+		// Function to set every final value equal to the corresponding initial value
+		std::memcpy(final_value, initial_value, n_slots * sizeof(double));
+	}
+
+	void resetValues()
+	{
+		// Function to start a new time step from the final values of the previous one
+		std::memcpy(initial_value, final_value, n_slots * sizeof(double));
+	}
+
+	VariableStore() : initial_value(0), final_value(0), bound_values(0), n_slots(0), n_bound(0) { }
+	~VariableStore() { }
+};
+
+#endif
@@ -20,5 +20,6 @@
 #include "SciantixScalingFactorDeclaration.h"
 #include "SciantixVariableDeclaration.h"
 #include "MapSciantixVariable.h"
+#include "OptionDispatching.h"
 
 void Xe133_in_UO2();
@@ -0,0 +1,199 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "AllocationCounting.h"
+#include "Trace.h"
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#ifdef SCIANTIX_ALLOCATION_COUNTING
+thread_local bool allocation_counting_enabled(true);
+#else
+thread_local bool allocation_counting_enabled(false);
+#endif
+
+// The counters are kept in fixed-size arrays, since the hooks cannot allocate
+const int allocation_stages_max = 128;
+const int allocation_stack_max = 64;
+
+static thread_local const char* allocation_stage_name[allocation_stages_max] = { "Outside stages" };
+static thread_local int allocation_stages(1);
+static thread_local unsigned long long int allocation_step_count[allocation_stages_max];
+static thread_local unsigned long long int allocation_step_bytes[allocation_stages_max];
+static thread_local unsigned long long int allocation_total_count[allocation_stages_max];
+static thread_local unsigned long long int allocation_total_bytes[allocation_stages_max];
+
+static thread_local int allocation_stack[allocation_stack_max];
+static thread_local int allocation_stack_depth(0);
+
+// Allocations are not counted while the counting routines write their own output
+static thread_local bool allocation_counting_active(false);
+
+static thread_local std::ofstream allocation_file;
+
+static int AllocationStageIndex(const char* stage_name)
+{
+	for (int i = 1; i < allocation_stages; ++i)
+	{
+		if (allocation_stage_name[i] == stage_name || strcmp(allocation_stage_name[i], stage_name) == 0)
+			return i;
+	}
+
+	if (allocation_stages == allocation_stages_max) return 0;
+
+	allocation_stage_name[allocation_stages] = stage_name;
+	return allocation_stages++;
+}
+
+void AllocationCountingOpen(std::string file_name)
+{
+	if (!allocation_counting_enabled) return;
+
+	allocation_file.open(file_name, std::ios::out);
+	allocation_file << "Time step\tStage\tAllocations\tBytes\t" << std::endl;
+
+	allocation_counting_active = true;
+}
+
+void AllocationCountingBegin(const char* stage_name)
+{
+	if (!allocation_counting_enabled) return;
+
+	if (allocation_stack_depth < allocation_stack_max)
+		allocation_stack[allocation_stack_depth] = AllocationStageIndex(stage_name);
+
+	allocation_stack_depth++;
+}
+
+void AllocationCountingEnd()
+{
+	if (!allocation_counting_enabled || allocation_stack_depth == 0) return;
+
+	allocation_stack_depth--;
+}
+
+void AllocationCountingTimeStep(long long int time_step_number)
+{
+	if (!allocation_counting_enabled || !allocation_counting_active) return;
+
+	allocation_counting_active = false;
+
+	unsigned long long int step_count(0), step_bytes(0);
+	for (int i = 0; i < allocation_stages; ++i)
+	{
+		if (allocation_step_count[i] > 0)
+			allocation_file << time_step_number << "\t" << allocation_stage_name[i] << "\t" << allocation_step_count[i] << "\t" << allocation_step_bytes[i] << "\t" << std::endl;
+
+		step_count += allocation_step_count[i];
+		step_bytes += allocation_step_bytes[i];
+
+		allocation_total_count[i] += allocation_step_count[i];
+		allocation_total_bytes[i] += allocation_step_bytes[i];
+		allocation_step_count[i] = 0;
+		allocation_step_bytes[i] = 0;
+	}
+	allocation_file << time_step_number << "\tTotal\t" << step_count << "\t" << step_bytes << "\t" << std::endl;
+
+	TraceCounter("Heap allocations", step_count);
+
+	allocation_counting_active = true;
+}
+
+void AllocationCountingClose(std::string file_name)
+{
+	if (!allocation_counting_enabled || !allocation_counting_active) return;
+
+	allocation_counting_active = false;
+	allocation_file.close();
+
+	std::ofstream summary_file;
+	summary_file.open(file_name, std::ios::out);
+	summary_file << "Stage\tAllocations\tBytes\t" << std::endl;
+
+	unsigned long long int total_count(0), total_bytes(0);
+	for (int i = 0; i < allocation_stages; ++i)
+	{
+		if (allocation_total_count[i] > 0)
+			summary_file << allocation_stage_name[i] << "\t" << allocation_total_count[i] << "\t" << allocation_total_bytes[i] << "\t" << std::endl;
+
+		total_count += allocation_total_count[i];
+		total_bytes += allocation_total_bytes[i];
+	}
+	summary_file << "Total\t" << total_count << "\t" << total_bytes << "\t" << std::endl;
+	summary_file.close();
+}
+
+#ifdef SCIANTIX_ALLOCATION_COUNTING
+
+static void AllocationCount(std::size_t size)
+{
+	if (!allocation_counting_active) return;
+
+	int stage = (allocation_stack_depth > 0 && allocation_stack_depth <= allocation_stack_max) ? allocation_stack[allocation_stack_depth - 1] : 0;
+
+	allocation_step_count[stage]++;
+	allocation_step_bytes[stage] += size;
+}
+
+// Replacement of the global allocation functions (the aligned and sized variants fall back on these)
+
+void* operator new(std::size_t size)
+{
+	AllocationCount(size);
+
+	void* pointer = std::malloc(size == 0 ? 1 : size);
+	if (!pointer) throw std::bad_alloc();
+	return pointer;
+}
+
+void* operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+	AllocationCount(size);
+	return std::malloc(size == 0 ? 1 : size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+	return operator new(size, std::nothrow);
+}
+
+void operator delete(void* pointer) noexcept
+{
+	std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+	std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+	std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+	std::free(pointer);
+}
+
+#endif
@@ -0,0 +1,155 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+/// Checkpoint
+/// This routine writes and reads the binary checkpoint files of a SCIANTIX simulation (--checkpoint, --checkpoint-interval, --resume).
+/// A checkpoint holds the state after a time step (CheckpointState). A simulation resumed from it reads the input files as usual,
+/// takes the state (including options and scaling factors) from the checkpoint, and continues with the following time step of the
+/// input history, appending to output.txt: with the same input files, the output is the same as the one of the uninterrupted simulation.
+
+#include "Checkpoint.h"
+
+static const char checkpoint_format[8] = { 'S', 'C', 'I', 'A', 'N', 'T', 'I', 'X' };
+static const unsigned int checkpoint_version = 1;
+
+static unsigned long long int CheckpointChecksum(const CheckpointState& state)
+{
+	/// FNV-1a (64 bit) of the bytes of the state
+	const unsigned char* byte = reinterpret_cast<const unsigned char*>(&state);
+	unsigned long long int hash = 14695981039346656037ull;
+	for (std::size_t i = 0; i < sizeof(CheckpointState); ++i)
+	{
+		hash ^= byte[i];
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+void CheckpointSave(CheckpointState& state)
+{
+	// The padding bytes are zeroed, so that the checksum depends only on the state
+	std::memset(&state, 0, sizeof(CheckpointState));
+
+	state.time_step_number = Time_step_number;
+	state.time_h = Time_h;
+	state.time_s = Time_s;
+	std::copy(Sciantix_options, Sciantix_options + 40, state.options);
+	std::copy(Sciantix_history, Sciantix_history + 20, state.history);
+	std::copy(Sciantix_variables, Sciantix_variables + 300, state.variables);
+	std::copy(Sciantix_scaling_factors, Sciantix_scaling_factors + 10, state.scaling_factors);
+	std::copy(Sciantix_diffusion_modes, Sciantix_diffusion_modes + 1000, state.diffusion_modes);
+}
+
+void CheckpointRestore(const CheckpointState& state)
+{
+	Time_step_number = state.time_step_number;
+	Time_h = state.time_h;
+	Time_s = state.time_s;
+	std::copy(state.options, state.options + 40, Sciantix_options);
+	std::copy(state.history, state.history + 20, Sciantix_history);
+	std::copy(state.variables, state.variables + 300, Sciantix_variables);
+	std::copy(state.scaling_factors, state.scaling_factors + 10, Sciantix_scaling_factors);
+	std::copy(state.diffusion_modes, state.diffusion_modes + 1000, Sciantix_diffusion_modes);
+}
+
+void CheckpointWrite(const std::string& file_name)
+{
+	CheckpointState state;
+	CheckpointSave(state);
+
+	const unsigned int state_size = sizeof(CheckpointState);
+	const unsigned long long int checksum = CheckpointChecksum(state);
+
+	// The checkpoint is written to a temporary file and then renamed, so that an interrupted run leaves the previous checkpoint intact
+	const std::string temporary_name = file_name + ".tmp";
+	std::ofstream checkpoint_file(temporary_name, std::ios::out | std::ios::binary);
+	checkpoint_file.write(checkpoint_format, sizeof(checkpoint_format));
+	checkpoint_file.write(reinterpret_cast<const char*>(&checkpoint_version), sizeof(checkpoint_version));
+	checkpoint_file.write(reinterpret_cast<const char*>(&state_size), sizeof(state_size));
+	checkpoint_file.write(reinterpret_cast<const char*>(&state), sizeof(state));
+	checkpoint_file.write(reinterpret_cast<const char*>(&checksum), sizeof(checksum));
+	checkpoint_file.close();
+
+	if (!checkpoint_file || std::rename(temporary_name.c_str(), file_name.c_str()) != 0)
+		ErrorMessages::Checkpoint(file_name, "cannot be written");
+}
+
+void CheckpointRead(const std::string& file_name, CheckpointState& state)
+{
+	char format[sizeof(checkpoint_format)];
+	unsigned int version(0), state_size(0);
+	unsigned long long int checksum(0);
+
+	std::ifstream checkpoint_file(file_name, std::ios::in | std::ios::binary);
+	if (!checkpoint_file)
+		ErrorMessages::Checkpoint(file_name, "cannot be opened");
+
+	checkpoint_file.read(format, sizeof(format));
+	checkpoint_file.read(reinterpret_cast<char*>(&version), sizeof(version));
+	checkpoint_file.read(reinterpret_cast<char*>(&state_size), sizeof(state_size));
+	if (!checkpoint_file || std::memcmp(format, checkpoint_format, sizeof(format)) != 0)
+		ErrorMessages::Checkpoint(file_name, "is not a SCIANTIX checkpoint");
+	if (version != checkpoint_version || state_size != sizeof(CheckpointState))
+		ErrorMessages::Checkpoint(file_name, "was written by an incompatible version of SCIANTIX");
+
+	checkpoint_file.read(reinterpret_cast<char*>(&state), sizeof(state));
+	checkpoint_file.read(reinterpret_cast<char*>(&checksum), sizeof(checksum));
+	if (!checkpoint_file || checksum != CheckpointChecksum(state))
+		ErrorMessages::Checkpoint(file_name, "is truncated or corrupted (checksum mismatch)");
+}
+
+std::string CheckpointIntervalFile(const std::string& file_name, long long int time_step_number)
+{
+	// The time step number is inserted before the extension, if any (checkpoint.bin -> checkpoint_20.bin)
+	const std::size_t dot = file_name.find_last_of('.');
+	const std::size_t slash = file_name.find_last_of("/\\");
+
+	if (dot == std::string::npos || (slash != std::string::npos && dot < slash))
+		return file_name + "_" + std::to_string(time_step_number);
+	else
+		return file_name.substr(0, dot) + "_" + std::to_string(time_step_number) + file_name.substr(dot);
+}
+
+void CheckpointTimeStep()
+{
+	if (Checkpoint_interval > 0 && Time_step_number > 0 && Time_step_number % Checkpoint_interval == 0)
+		CheckpointWrite(Simulation_directory + CheckpointIntervalFile(Checkpoint_file, Time_step_number));
+}
+
+bool CheckpointResume(const std::string& file_name)
+{
+	CheckpointState state;
+	CheckpointRead(file_name, state);
+
+	return CheckpointResume(state);
+}
+
+bool CheckpointResume(const CheckpointState& state)
+{
+	CheckpointRestore(state);
+
+	// As at the end of SimulationTimeStep, with the input history of the resumed simulation
+	dTime_h = TimeStepCalculation();
+	Sciantix_history[6] = dTime_h * 3600;
+
+	if (Time_h < Time_end_h)
+	{
+		Time_step_number++;
+		Time_h += dTime_h;
+		Time_s += Sciantix_history[6];
+		return true;
+	}
+	else return false;
+}
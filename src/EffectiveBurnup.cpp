@@ -31,16 +31,16 @@ void EffectiveBurnup()
 	model[model_index].setName("Effective burnup");
 
 	std::string reference;
-	std::vector<double> parameter;
+	ModelParameter parameter;
 
 	double temperature_threshold = matrix[0].getHealingTemperatureThreshold();
 
 	if ((history_variable[hv["Temperature"]].getFinalValue()) <= temperature_threshold)
-		parameter.push_back(sciantix_variable[sv["Specific power"]].getFinalValue() / 86400.0);
+		parameter.effective_burnup.burnup_rate = sciantix_variable[sv["Specific power"]].getFinalValue() / 86400.0;
 	else if (history_variable[hv["Temperature"]].getFinalValue() > temperature_threshold && history_variable[hv["Temperature"]].getInitialValue() < temperature_threshold)
-		parameter.push_back(sciantix_variable[sv["Specific power"]].getFinalValue() / 86400.0);
+		parameter.effective_burnup.burnup_rate = sciantix_variable[sv["Specific power"]].getFinalValue() / 86400.0;
 	else
-		parameter.push_back(0.0);
+		parameter.effective_burnup.burnup_rate = 0.0;
 
 	/// @ref G. Khvostov et al., WRFPM-2005, Kyoto, Japan, 2005
 	reference += ": G. Khvostov et al., WRFPM-2005, Kyoto, Japan, 2005.";
@@ -0,0 +1,128 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+/// RunEnsemble
+/// This routine runs an ensemble of simulations (branches) forked from the same state, e.g., several transients following the same
+/// base irradiation, without simulating the common part again for each branch.
+/// The checkpoint of the common state (--resume) is read once and shared, read-only, by all the branches: each branch copies it into
+/// its own (thread_local) state when it starts, and evolves only its copy. The branches run concurrently, one per thread.
+/// Each branch directory holds the input files that differ from the ones of the working directory (e.g., input_history.txt,
+/// with the time points of the base irradiation followed by the transient, and/or input_scaling_factors.txt); the other input files
+/// are read from the working directory. The input settings are the ones of the checkpoint.
+/// The output files of a branch are written in its directory, and its output.txt starts with the output.txt of the working directory
+/// (the one of the simulation that wrote the checkpoint), so that it covers the whole simulation.
+/// An error in a branch (ErrorMessages) stops only that branch: its error_log.txt is written in the branch directory, the other
+/// branches go on, and the ensemble fails at the end listing the failed branches.
+
+#include "Ensemble.h"
+
+static void RunBranch(const std::string& directory, const CheckpointState& base)
+{
+	// The scaling factors of the branch, when given, replace the ones of the checkpoint (SimulationStepper)
+	SimulationStepper branch(directory, base);
+
+	while (branch.step());
+
+	branch.finish();
+}
+
+void RunEnsemble()
+{
+	if (Resume_file.empty())
+		ErrorMessages::Ensemble(Ensemble_file, "requires the checkpoint of the common state (--resume <file>)");
+
+	// One branch directory per line, empty lines and comments (#) are skipped
+	std::ifstream ensemble_file(Ensemble_file);
+	if (!ensemble_file)
+		ErrorMessages::Ensemble(Ensemble_file, "cannot be read");
+
+	std::vector<std::string> branches;
+	std::string line;
+	while (std::getline(ensemble_file, line))
+	{
+		line.erase(0, line.find_first_not_of(" \t\r"));
+		line.erase(line.find_last_not_of(" \t\r") + 1);
+		if (line.empty() || line[0] == '#') continue;
+
+		if (line[line.size() - 1] != '/') line += '/';
+		branches.push_back(line);
+	}
+
+	if (branches.empty())
+		ErrorMessages::Ensemble(Ensemble_file, "does not list any branch directory");
+
+	// The common state is read once
+	CheckpointState base;
+	CheckpointRead(Resume_file, base);
+
+	// The output of the common part of the simulation starts the output.txt of each branch
+	std::ifstream base_output_file("output.txt");
+	std::stringstream base_output;
+	if (base_output_file.is_open()) base_output << base_output_file.rdbuf();
+
+	for (std::vector<std::string>::size_type b = 0; b < branches.size(); ++b)
+	{
+		std::ofstream branch_output(branches[b] + "output.txt", std::ios::out);
+		if (!branch_output)
+			ErrorMessages::Ensemble(Ensemble_file, "lists the directory " + branches[b] + ", where output.txt cannot be written");
+		branch_output << base_output.str();
+	}
+
+	int threads = (Ensemble_threads > 0) ? Ensemble_threads : int(std::thread::hardware_concurrency());
+	threads = std::max(1, std::min(threads, int(branches.size())));
+
+	// Each thread runs the next branch not started yet
+	std::atomic<int> next_branch(0);
+	std::vector<std::string> branch_errors(branches.size());
+	std::vector<std::thread> pool;
+	for (int t = 0; t < threads; ++t)
+	{
+		pool.push_back(std::thread([&]()
+		{
+			// An error must not exit the process while the other branches run
+			ErrorMessages::throw_errors = true;
+
+			for (int b = next_branch++; b < int(branches.size()); b = next_branch++)
+			{
+				try
+				{
+					RunBranch(branches[b], base);
+				}
+				catch (const std::exception& error)
+				{
+					// As in sciantix_advance, the objects of an interrupted time step are cleared, and the next branch
+					// of the thread defines its input variables and schedules its models again
+					SciantixClear();
+					input_variable.clear();
+
+					branch_errors[b] = error.what();
+					std::ofstream error_log(branches[b] + "error_log.txt", std::ios::out);
+					error_log << branch_errors[b];
+				}
+			}
+		}));
+	}
+
+	for (std::vector<std::thread>::size_type t = 0; t < pool.size(); ++t)
+		pool[t].join();
+
+	std::string failed_branches;
+	for (std::vector<std::string>::size_type b = 0; b < branches.size(); ++b)
+		if (!branch_errors[b].empty()) failed_branches += " " + branches[b];
+
+	if (!failed_branches.empty())
+		ErrorMessages::Ensemble(Ensemble_file, "lists branches that failed (see error_log.txt in their directories):" + failed_branches);
+}
@@ -29,20 +29,26 @@ void EnvironmentComposition()
    * 
    */
 
-	if (!input_variable[iv["iStoichiometryDeviation"]].getValue()) return;
-
   model.emplace_back();
   int model_index = int(model.size()) - 1;
   model[model_index].setName("Environment composition");
 
   std::string reference;
   
-  /// @param equilibrium_constant law of mass action for the water vapour decomposition
-  /// @ref Morel et al., CEA, Report NT/DTP/SECC no. DR94-55 (1994)
-  double equilibrium_constant = exp(-25300.0 / history_variable[hv["Temperature"]].getFinalValue() + 4.64 + 1.04 * (0.0007 * history_variable[hv["Temperature"]].getFinalValue() - 0.2)); // (atm)
-
   double steam_pressure = history_variable[hv["Steam pressure"]].getFinalValue(); // (atm)
-  double gap_oxigen_partial_pressure = pow(pow(equilibrium_constant,2)*pow(steam_pressure,2)/4, 1.0/3.0); // (atm)
+  double gap_oxigen_partial_pressure; // (atm)
+
+  static thread_local PropertyMemo<2> memo("Gap oxygen partial pressure");
+  const double inputs[] = { history_variable[hv["Temperature"]].getFinalValue(), steam_pressure };
+  if (!memo.Find(inputs, gap_oxigen_partial_pressure))
+  {
+    /// @param equilibrium_constant law of mass action for the water vapour decomposition
+    /// @ref Morel et al., CEA, Report NT/DTP/SECC no. DR94-55 (1994)
+    double equilibrium_constant = exp(-25300.0 / inputs[0] + 4.64 + 1.04 * (0.0007 * inputs[0] - 0.2)); // (atm)
+
+    gap_oxigen_partial_pressure = pow(pow(equilibrium_constant,2)*pow(steam_pressure,2)/4, 1.0/3.0); // (atm)
+    memo.Store(inputs, gap_oxigen_partial_pressure);
+  }
 
   sciantix_variable[sv["Gap oxygen partial pressure"]].setFinalValue(gap_oxigen_partial_pressure); // (atm)
   
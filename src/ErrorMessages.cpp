@@ -22,16 +22,90 @@ namespace ErrorMessages
 	 * @brief ErrorMessages is a namespace that contains the possibile error messages that a user can produce by providing wrong inputs to SCIANTIX.
 	 */
 
+	thread_local bool throw_errors(false);
+
+	static void Stop(const std::string& message)
+	{
+		/// The message is written in error_log.txt and SCIANTIX exits, or it is thrown (Error) when the thread sets throw_errors
+		if (throw_errors)
+			throw Error(message);
+
+		std::ofstream Error_log;
+		Error_log.open("error_log.txt", std::ios::out);
+		Error_log << message;
+		Error_log.close();
+		exit(1);
+	}
+
 	void Switch(std::string routine, std::string variable_name, int variable)
 	{
 		/**
 		 * @brief This function prints an error_log.txt file when an input setting is out of the acceptable range of values.
 		 * 
 		 */
-		std::ofstream Error_log;
-		Error_log.open("error_log.txt", std::ios::out);
+		std::stringstream Error_log;
 		Error_log << "Error in " << routine << "." << std::endl;
 		Error_log << "The input setting " << variable_name << " = " << variable << " is out of range." << std::endl;
-		exit(1);
+		Stop(Error_log.str());
+	}
+
+	void CommandLine(std::string argument)
+	{
+		/**
+		 * @brief This function prints an error_log.txt file when a command-line argument of sciantix.x is not recognized.
+		 * 
+		 */
+		std::stringstream Error_log;
+		Error_log << "Error in CommandLineReading." << std::endl;
+		Error_log << "The command-line argument " << argument << " is not recognized." << std::endl;
+		Stop(Error_log.str());
+	}
+
+	void EmptyInputHistory()
+	{
+		/**
+		 * @brief This function prints an error_log.txt file when input_history.txt is missing or does not contain any time point.
+		 * 
+		 */
+		std::stringstream Error_log;
+		Error_log << "Error in InputReading." << std::endl;
+		Error_log << "The file input_history.txt is missing or does not contain any time point." << std::endl;
+		Stop(Error_log.str());
+	}
+
+	void InputHistory(int row, std::string problem)
+	{
+		/**
+		 * @brief This function prints an error_log.txt file when a row of input_history.txt is malformed.
+		 * 
+		 */
+		std::stringstream Error_log;
+		Error_log << "Error in InputReading." << std::endl;
+		Error_log << "Row " << row << " of input_history.txt " << problem << "." << std::endl;
+		Stop(Error_log.str());
+	}
+
+	void Checkpoint(std::string file_name, std::string problem)
+	{
+		/**
+		 * @brief This function prints an error_log.txt file when a checkpoint file cannot be written or read.
+		 * 
+		 */
+		std::stringstream Error_log;
+		Error_log << "Error in Checkpoint." << std::endl;
+		Error_log << "The checkpoint file " << file_name << " " << problem << "." << std::endl;
+		Stop(Error_log.str());
+	}
+
+	void Ensemble(std::string file_name, std::string problem)
+	{
+		/**
+		 * @brief This function prints an error_log.txt file when the ensemble of branches (--ensemble) cannot be run.
+		 * 
+		 */
+		std::stringstream Error_log;
+		Error_log << "Error in RunEnsemble." << std::endl;
+		Error_log << "The ensemble file " << file_name << " " << problem << "." << std::endl;
+		Stop(Error_log.str());
 	}
 }
@@ -18,4 +18,4 @@
 
 /// GasDeclaration
 
-std::vector<Gas> gas;
+thread_local std::vector<Gas> gas;
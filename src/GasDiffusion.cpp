@@ -16,6 +16,7 @@
 
 #include "GasDiffusion.h"
 
+template <int iDiffusionSolver>
 void GasDiffusion()
 {
 	/**
@@ -27,12 +28,12 @@ void GasDiffusion()
 	 */
 
 	std::string reference;
-	switch (int(input_variable[iv["iDiffusionSolver"]].getValue()))
+	switch (iDiffusionSolver)
 	{
 	case 1:
 	{
 		int model_index;
-		std::vector<double> parameter;
+		ModelParameter parameter;
 		for (std::vector<System>::size_type i = 0; i != sciantix_system.size(); ++i)
 		{
 			model.emplace_back();
@@ -40,39 +41,29 @@ void GasDiffusion()
 			model[model_index].setName("Gas diffusion - " + sciantix_system[i].getName());
 			model[model_index].setRef(reference);
 
-			parameter.push_back(n_modes);
+			parameter.gas_diffusion.n_modes = n_modes;
 			if (sciantix_system[i].getResolutionRate() + sciantix_system[i].getTrappingRate() == 0)
-				parameter.push_back(sciantix_system[i].getFissionGasDiffusivity() * gas[ga[sciantix_system[i].getGasName()]].getPrecursorFactor());
+				parameter.gas_diffusion.diffusion_coefficient = sciantix_system[i].getFissionGasDiffusivity() * gas[ga[sciantix_system[i].getGasName()]].getPrecursorFactor();
 			else
-				parameter.push_back(
+				parameter.gas_diffusion.diffusion_coefficient =
 					sciantix_system[i].getResolutionRate() /
 					(sciantix_system[i].getResolutionRate() + sciantix_system[i].getTrappingRate()) * sciantix_system[i].getFissionGasDiffusivity() * gas[ga[sciantix_system[i].getGasName()]].getPrecursorFactor() + 
 					sciantix_system[i].getTrappingRate() /
-					(sciantix_system[i].getResolutionRate() + sciantix_system[i].getTrappingRate()) * sciantix_system[i].getBubbleDiffusivity() 
-				);
+					(sciantix_system[i].getResolutionRate() + sciantix_system[i].getTrappingRate()) * sciantix_system[i].getBubbleDiffusivity();
 
-			parameter.push_back(sciantix_variable[sv["Grain radius"]].getFinalValue());
-			parameter.push_back(sciantix_system[i].getProductionRate());
-			parameter.push_back(gas[ga[sciantix_system[i].getGasName()]].getDecayRate());
+			parameter.gas_diffusion.domain_radius = sciantix_variable[sv["Grain radius"]].getFinalValue();
+			parameter.gas_diffusion.source_term = sciantix_system[i].getProductionRate();
+			parameter.gas_diffusion.decay_rate = gas[ga[sciantix_system[i].getGasName()]].getDecayRate();
 
 			model[model_index].setParameter(parameter);
-			parameter.clear();
 		}
 		break;
 	}
 
 	case 2:
 	{
-		// parameter --> N
-		//               diffusion_coefficient
-		//               resolution_rate
-		//               trapping_rate
-		//               decay rate 
-		//               domain_radius 
-		//               source_term 
-		//               source_term_bubbles
 		int model_index;
-		std::vector<double> parameter;
+		ModelParameter parameter;
 
 		for (std::vector<System>::size_type i = 0; i != sciantix_system.size(); ++i)
 		{
@@ -81,26 +72,37 @@ void GasDiffusion()
 			model[model_index].setName("Gas diffusion - " + sciantix_system[i].getName());
 			model[model_index].setRef(reference);
 
-			parameter.push_back(n_modes);
-			parameter.push_back(sciantix_system[i].getFissionGasDiffusivity() * gas[ga[sciantix_system[i].getGasName()]].getPrecursorFactor());
-			parameter.push_back(sciantix_system[i].getResolutionRate());
-			parameter.push_back(sciantix_system[i].getTrappingRate());
-			parameter.push_back(gas[ga[sciantix_system[i].getGasName()]].getDecayRate());
+			parameter.gas_diffusion_non_equilibrium.n_modes = n_modes;
+			parameter.gas_diffusion_non_equilibrium.diffusion_coefficient = sciantix_system[i].getFissionGasDiffusivity() * gas[ga[sciantix_system[i].getGasName()]].getPrecursorFactor();
+			parameter.gas_diffusion_non_equilibrium.resolution_rate = sciantix_system[i].getResolutionRate();
+			parameter.gas_diffusion_non_equilibrium.trapping_rate = sciantix_system[i].getTrappingRate();
+			parameter.gas_diffusion_non_equilibrium.decay_rate = gas[ga[sciantix_system[i].getGasName()]].getDecayRate();
 
-			parameter.push_back(sciantix_variable[sv["Grain radius"]].getFinalValue());
+			parameter.gas_diffusion_non_equilibrium.domain_radius = sciantix_variable[sv["Grain radius"]].getFinalValue();
 
-			parameter.push_back(sciantix_system[i].getProductionRate());
-			parameter.push_back(0.0);
-			parameter.push_back(sciantix_system[i].getBubbleDiffusivity());
+			parameter.gas_diffusion_non_equilibrium.source_term = sciantix_system[i].getProductionRate();
+			parameter.gas_diffusion_non_equilibrium.source_term_bubbles = 0.0;
+			parameter.gas_diffusion_non_equilibrium.bubble_diffusivity = sciantix_system[i].getBubbleDiffusivity();
 			
 			model[model_index].setParameter(parameter);
-			parameter.clear();
 		}
 		break;
 	}
+	}
+}
 
-	default:
-		ErrorMessages::Switch("GasDiffusion.cpp", "iDiffusionSolver", int(input_variable[iv["iDiffusionSolver"]].getValue()));
-		break;
+template void GasDiffusion<1>();
+template void GasDiffusion<2>();
+
+ModelDefinition GasDiffusionDefinition(int iDiffusionSolver)
+{
+	switch (iDiffusionSolver)
+	{
+		case 1: return &GasDiffusion<1>;
+		case 2: return &GasDiffusion<2>;
+
+		default:
+			ErrorMessages::Switch("GasDiffusion.cpp", "iDiffusionSolver", iDiffusionSolver);
+			return nullptr;
 	}
 }
@@ -22,7 +22,7 @@
 void GasProduction()
 {
 	int model_index;
-	std::vector<double> parameter;
+	ModelParameter parameter;
 
 	for (std::vector<System>::size_type i = 0; i != sciantix_system.size(); ++i)
 	{
@@ -32,11 +32,9 @@ void GasProduction()
 
 		model[model_index].setRef(" ");
 
-		parameter.push_back(sciantix_system[i].getProductionRate());
-		parameter.push_back(physics_variable[pv["Time step"]].getFinalValue());
+		parameter.gas_production.production_rate = sciantix_system[i].getProductionRate();
+		parameter.gas_production.time_step = physics_variable[pv["Time step"]].getFinalValue();
 
 		model[model_index].setParameter(parameter);
-
-		parameter.clear();
 	}
 }
@@ -18,12 +18,10 @@
 
 void GrainBoundaryMicroCracking()
 {
-	if (!input_variable[iv["iGrainBoundaryMicroCracking"]].getValue()) return;
-
 	model.emplace_back();
 	int model_index = int(model.size()) - 1;
 	model[model_index].setName("Grain-boundary micro-cracking");
-	std::vector<double> parameter;
+	ModelParameter parameter;
 
 	const double dTemperature = history_variable[hv["Temperature"]].getIncrement();
 
@@ -37,11 +35,11 @@ void GrainBoundaryMicroCracking()
 	const double arg = (transient_type / span) * (history_variable[hv["Temperature"]].getFinalValue() - inflection);
 	const double microcracking_parameter = (transient_type / span) * exp(arg) * pow((exponent * exp(arg) + 1), -1. / exponent - 1.); // dm/dT
 
-	parameter.push_back(microcracking_parameter);
+	parameter.grain_boundary_micro_cracking.microcracking_parameter = microcracking_parameter;
 
 	// healing parameter
 	const double healing_parameter = 1.0 / 0.8814; // 1 / (u * burnup)
-	parameter.push_back(healing_parameter);
+	parameter.grain_boundary_micro_cracking.healing_parameter = healing_parameter;
 
 	model[model_index].setParameter(parameter);
 	model[model_index].setRef("from Barani et al. (2017), JNM");
@@ -22,6 +22,7 @@
  * 
  */
 
+template <int iGrainBoundarySweeping>
 void GrainBoundarySweeping()
 {
 	model.emplace_back();
@@ -29,12 +30,12 @@ void GrainBoundarySweeping()
 
 	model[model_index].setName("Grain-boundary sweeping");
 
-	switch (int(input_variable[iv["iGrainBoundarySweeping"]].getValue()))
+	switch (iGrainBoundarySweeping)
 	{
 	case 0:
 	{
-		std::vector<double> parameter;
-		parameter.push_back(0.0);
+		ModelParameter parameter;
+		parameter.grain_boundary_sweeping.swept_volume_fraction = 0.0;
 		model[model_index].setParameter(parameter);
 		model[model_index].setRef("Not considered");
 
@@ -49,17 +50,29 @@ void GrainBoundarySweeping()
 		 *  
 		 */
 
-		std::vector<double> parameter;
+		ModelParameter parameter;
 		/// @param[out] grain_sweeped_volume
-		parameter.push_back(3 * sciantix_variable[sv["Grain radius"]].getIncrement() / sciantix_variable[sv["Grain radius"]].getFinalValue());
+		parameter.grain_boundary_sweeping.swept_volume_fraction = 3 * sciantix_variable[sv["Grain radius"]].getIncrement() / sciantix_variable[sv["Grain radius"]].getFinalValue();
 		model[model_index].setParameter(parameter);
 		model[model_index].setRef("TRANSURANUS model");
 
 		break;
 	}
+	}
+}
 
-	default:
-		ErrorMessages::Switch("GrainBoundarySweeping.cpp", "iGrainBoundarySweeping", int(input_variable[iv["iGrainBoundarySweeping"]].getValue()));
-		break;
+template void GrainBoundarySweeping<0>();
+template void GrainBoundarySweeping<1>();
+
+ModelDefinition GrainBoundarySweepingDefinition(int iGrainBoundarySweeping)
+{
+	switch (iGrainBoundarySweeping)
+	{
+		case 0: return &GrainBoundarySweeping<0>;
+		case 1: return &GrainBoundarySweeping<1>;
+
+		default:
+			ErrorMessages::Switch("GrainBoundarySweeping.cpp", "iGrainBoundarySweeping", iGrainBoundarySweeping);
+			return nullptr;
 	}
 }
@@ -16,19 +16,20 @@
 
 #include "GrainBoundaryVenting.h"
 
+template <int iGrainBoundaryVenting>
 void GrainBoundaryVenting()
 {
 	model.emplace_back();
 	int model_index = int(model.size()) - 1;
 	model[model_index].setName("Grain-boundary venting");
 
-	std::vector<double> parameter;
+	ModelParameter parameter;
 	std::string reference;
 
 	/// @brief
 	/// These model defines the venting of fission gas from the grain boundaries of the UO2 fuel matrix.
 
-	switch (int(input_variable[iv["iGrainBoundaryVenting"]].getValue()))
+	switch (iGrainBoundaryVenting)
 	{
 	case 0:
 	{
@@ -37,9 +38,9 @@ void GrainBoundaryVenting()
 
 		reference = "not considered.";
 
-		parameter.push_back(0.0);
-		parameter.push_back(0.0);
-		parameter.push_back(0.0);
+		parameter.grain_boundary_venting.screw_parameter = 0.0;
+		parameter.grain_boundary_venting.span_parameter = 0.0;
+		parameter.grain_boundary_venting.cent_parameter = 0.0;
 
 		break;
 	}
@@ -51,24 +52,20 @@ void GrainBoundaryVenting()
 
 		// screw parameter
 		const double screw_parameter = 0.1;
-		parameter.push_back(sf_screw_parameter * screw_parameter);
+		parameter.grain_boundary_venting.screw_parameter = sf_screw_parameter * screw_parameter;
 
 		// span parameter
 		const double span_parameter = 10.0;
-		parameter.push_back(sf_span_parameter * span_parameter);
+		parameter.grain_boundary_venting.span_parameter = sf_span_parameter * span_parameter;
 
 		// cent parameter
 		const double cent_parameter = 0.43;
-		parameter.push_back(sf_cent_parameter * cent_parameter);
+		parameter.grain_boundary_venting.cent_parameter = sf_cent_parameter * cent_parameter;
 
 		reference = "from Pizzocri et al., D6.4 (2020), H2020 Project INSPYRE";
 
 		break;
 	}
-
-	default:
-		ErrorMessages::Switch("GrainBoundaryVenting.cpp", "iGrainBoundaryVenting", int(input_variable[iv["iGrainBoundaryVenting"]].getValue()));
-		break;
 	}
 
 	model[model_index].setParameter(parameter);
@@ -76,3 +73,18 @@ void GrainBoundaryVenting()
 
 }
 
+template void GrainBoundaryVenting<0>();
+template void GrainBoundaryVenting<1>();
+
+ModelDefinition GrainBoundaryVentingDefinition(int iGrainBoundaryVenting)
+{
+	switch (iGrainBoundaryVenting)
+	{
+		case 0: return &GrainBoundaryVenting<0>;
+		case 1: return &GrainBoundaryVenting<1>;
+
+		default:
+			ErrorMessages::Switch("GrainBoundaryVenting.cpp", "iGrainBoundaryVenting", iGrainBoundaryVenting);
+			return nullptr;
+	}
+}
@@ -16,6 +16,7 @@
 
 #include "GrainGrowth.h"
 
+template <int iGrainGrowth>
 void GrainGrowth()
 {
 	/**
@@ -30,9 +31,9 @@ void GrainGrowth()
 
 	model[model_index].setName("Grain growth");
 	std::string reference;
-	std::vector<double> parameter;
+	ModelParameter parameter;
 
-	switch (int(input_variable[iv["iGrainGrowth"]].getValue()))
+	switch (iGrainGrowth)
 	{
 	case 0:
 	{
@@ -44,12 +45,12 @@ void GrainGrowth()
 
 		reference += "constant grain radius.";
 
-		parameter.push_back(sciantix_variable[sv["Grain radius"]].getInitialValue());
-		parameter.push_back(0.0);
-		parameter.push_back(0.0);
-		parameter.push_back(0.0);
-		parameter.push_back(1.0);
-		parameter.push_back(-sciantix_variable[sv["Grain radius"]].getInitialValue());
+		parameter.grain_growth.initial_value = sciantix_variable[sv["Grain radius"]].getInitialValue();
+		parameter.grain_growth.a = 0.0;
+		parameter.grain_growth.b = 0.0;
+		parameter.grain_growth.c = 0.0;
+		parameter.grain_growth.d = 1.0;
+		parameter.grain_growth.e = -sciantix_variable[sv["Grain radius"]].getInitialValue();
 
 		break;
 	}
@@ -74,23 +75,23 @@ void GrainGrowth()
 			double rate_constant = matrix[0].getGrainBoundaryMobility();
 			rate_constant *= (1.0 - burnup_factor / (limiting_grain_radius / (sciantix_variable[sv["Grain radius"]].getFinalValue())));
 
-			parameter.push_back(sciantix_variable[sv["Grain radius"]].getInitialValue());
-			parameter.push_back(0.0);
-			parameter.push_back(0.0);
-			parameter.push_back(1.0);
-			parameter.push_back(- sciantix_variable[sv["Grain radius"]].getInitialValue());
-			parameter.push_back(- rate_constant * physics_variable[pv["Time step"]].getFinalValue());
+			parameter.grain_growth.initial_value = sciantix_variable[sv["Grain radius"]].getInitialValue();
+			parameter.grain_growth.a = 0.0;
+			parameter.grain_growth.b = 0.0;
+			parameter.grain_growth.c = 1.0;
+			parameter.grain_growth.d = - sciantix_variable[sv["Grain radius"]].getInitialValue();
+			parameter.grain_growth.e = - rate_constant * physics_variable[pv["Time step"]].getFinalValue();
 
 		}
 
 		else
 		{
-			parameter.push_back(sciantix_variable[sv["Grain radius"]].getInitialValue());
-			parameter.push_back(0.0);
-			parameter.push_back(0.0);
-			parameter.push_back(0.0);
-			parameter.push_back(1.0);
-			parameter.push_back(- sciantix_variable[sv["Grain radius"]].getInitialValue());
+			parameter.grain_growth.initial_value = sciantix_variable[sv["Grain radius"]].getInitialValue();
+			parameter.grain_growth.a = 0.0;
+			parameter.grain_growth.b = 0.0;
+			parameter.grain_growth.c = 0.0;
+			parameter.grain_growth.d = 1.0;
+			parameter.grain_growth.e = - sciantix_variable[sv["Grain radius"]].getInitialValue();
 		}
 		break;
 	}
@@ -118,29 +119,43 @@ void GrainGrowth()
 		{
 			double rate_constant = matrix[0].getGrainBoundaryMobility();
 
-			parameter.push_back(sciantix_variable[sv["Grain radius"]].getInitialValue());
-			parameter.push_back(1.0);
-			parameter.push_back(- sciantix_variable[sv["Grain radius"]].getInitialValue());
-			parameter.push_back(0.0);
-			parameter.push_back(0.0);
-			parameter.push_back(- rate_constant * physics_variable[pv["Time step"]].getFinalValue());
+			parameter.grain_growth.initial_value = sciantix_variable[sv["Grain radius"]].getInitialValue();
+			parameter.grain_growth.a = 1.0;
+			parameter.grain_growth.b = - sciantix_variable[sv["Grain radius"]].getInitialValue();
+			parameter.grain_growth.c = 0.0;
+			parameter.grain_growth.d = 0.0;
+			parameter.grain_growth.e = - rate_constant * physics_variable[pv["Time step"]].getFinalValue();
 		}
 		else
 		{
-			parameter.push_back(sciantix_variable[sv["Grain radius"]].getInitialValue());
-			parameter.push_back(0.0);
-			parameter.push_back(0.0);
-			parameter.push_back(0.0);
-			parameter.push_back(1.0);
-			parameter.push_back(- sciantix_variable[sv["Grain radius"]].getInitialValue());
+			parameter.grain_growth.initial_value = sciantix_variable[sv["Grain radius"]].getInitialValue();
+			parameter.grain_growth.a = 0.0;
+			parameter.grain_growth.b = 0.0;
+			parameter.grain_growth.c = 0.0;
+			parameter.grain_growth.d = 1.0;
+			parameter.grain_growth.e = - sciantix_variable[sv["Grain radius"]].getInitialValue();
 		}
 		break;
 	}
-
-	default:
-		ErrorMessages::Switch("GrainGrowth.cpp", "iGrainGrowth", int(input_variable[iv["iGrainGrowth"]].getValue()));
-		break;
 	}
 	model[model_index].setParameter(parameter);
 	model[model_index].setRef(reference);
 }
+
+template void GrainGrowth<0>();
+template void GrainGrowth<1>();
+template void GrainGrowth<2>();
+
+ModelDefinition GrainGrowthDefinition(int iGrainGrowth)
+{
+	switch (iGrainGrowth)
+	{
+		case 0: return &GrainGrowth<0>;
+		case 1: return &GrainGrowth<1>;
+		case 2: return &GrainGrowth<2>;
+
+		default:
+			ErrorMessages::Switch("GrainGrowth.cpp", "iGrainGrowth", iGrainGrowth);
+			return nullptr;
+	}
+}
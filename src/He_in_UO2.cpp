@@ -32,11 +32,13 @@ void He_in_UO2()
 	sciantix_system[index].setYield(0.0022); // from ternary fissions
 	sciantix_system[index].setRadiusInLattice(4.73e-11);
 	sciantix_system[index].setVolumeInLattice(matrix[0].getOIS());
-	sciantix_system[index].setHeliumDiffusivity(int(input_variable[iv["iHeDiffusivity"]].getValue()));
-	sciantix_system[index].setResolutionRate(int(input_variable[iv["iResolutionRate"]].getValue()));
-	sciantix_system[index].setTrappingRate(int(input_variable[iv["iTrappingRate"]].getValue()));
-	sciantix_system[index].setNucleationRate(int(input_variable[iv["iNucleationRate"]].getValue()));
+	/// The Henry's constant must be set before the resolution rate, which reads it (thermal resolution): it is set at the temperature of the beginning of the time step.
+	sciantix_system[index].setHenryConstant(4.1e+18 * exp(-7543.5 / history_variable[hv["Temperature"]].getInitialValue()));
+	(sciantix_system[index].*option_dispatch.helium_diffusivity)();
+	(sciantix_system[index].*option_dispatch.resolution_rate)();
+	(sciantix_system[index].*option_dispatch.trapping_rate)();
+	(sciantix_system[index].*option_dispatch.nucleation_rate)();
 	sciantix_system[index].setHenryConstant(4.1e+18 * exp(-7543.5 / history_variable[hv["Temperature"]].getFinalValue())); /// The Henry's constant for helium in UO<sub>2</sub>-single crystal samples is set from best estimate correlation after @ref *L. Cognini et al. Nuclear Engineering and Design 340 (2018) 240–244*. This correlation is valid in the temperature range 1073-1773 K.
-	sciantix_system[index].setProductionRate(int(input_variable[iv["iHeliumProductionRate"]].getValue()));
-	sciantix_system[index].setBubbleDiffusivity(int(input_variable[iv["iBubbleDiffusivity"]].getValue()));
+	(sciantix_system[index].*option_dispatch.helium_production_rate)();
+	(sciantix_system[index].*option_dispatch.bubble_diffusivity)();
 }
@@ -16,6 +16,7 @@
 
 #include "HighBurnupStructureFormation.h"
 
+template <int iHighBurnupStructureFormation>
 void HighBurnupStructureFormation()
 {
 	/// @brief
@@ -28,9 +29,9 @@ void HighBurnupStructureFormation()
 	model[model_index].setName("High burnup structure formation");
 
 	std::string reference;
-	std::vector<double> parameter;
+	ModelParameter parameter;
 
-	switch (int(input_variable[iv["iHighBurnupStructureFormation"]].getValue()))
+	switch (iHighBurnupStructureFormation)
 	{
 	case 0:
 	{
@@ -41,8 +42,8 @@ void HighBurnupStructureFormation()
 		/// This case corresponds to the no HBS forming in the UO2 fuel matrix.
 
 		reference += ": not considered.";
-		parameter.push_back(0.0);
-		parameter.push_back(0.0);
+		parameter.high_burnup_structure_formation.avrami_constant = 0.0;
+		parameter.high_burnup_structure_formation.transformation_rate = 0.0;
 
 		break;
 	}
@@ -63,18 +64,30 @@ void HighBurnupStructureFormation()
 		double avrami_constant(3.54);
 		double transformation_rate(2.77e-7);
 
-		parameter.push_back(avrami_constant);
-		parameter.push_back(transformation_rate);
+		parameter.high_burnup_structure_formation.avrami_constant = avrami_constant;
+		parameter.high_burnup_structure_formation.transformation_rate = transformation_rate;
 
 		break;
 	}
-
-	default:
-		ErrorMessages::Switch("HighBurnupStructureFormation.cpp", "iHighBurnupStructureFormation", int(input_variable[iv["iHighBurnupStructureFormation"]].getValue()));
-		break;
 	}
 
 	model[model_index].setParameter(parameter);
 	model[model_index].setRef(reference);
 
 }
+
+template void HighBurnupStructureFormation<0>();
+template void HighBurnupStructureFormation<1>();
+
+ModelDefinition HighBurnupStructureFormationDefinition(int iHighBurnupStructureFormation)
+{
+	switch (iHighBurnupStructureFormation)
+	{
+		case 0: return &HighBurnupStructureFormation<0>;
+		case 1: return &HighBurnupStructureFormation<1>;
+
+		default:
+			ErrorMessages::Switch("HighBurnupStructureFormation.cpp", "iHighBurnupStructureFormation", iHighBurnupStructureFormation);
+			return nullptr;
+	}
+}
@@ -16,6 +16,7 @@
 
 #include "HighBurnupStructurePorosity.h"
 
+template <int iHighBurnupStructurePorosity>
 void HighBurnupStructurePorosity()
 {
 	/// @brief
@@ -27,9 +28,9 @@ void HighBurnupStructurePorosity()
 	double porosity_increment = 0.0;
 
 	std::string reference;
-	std::vector<double> parameter;
+	ModelParameter parameter;
 
-	switch (int(input_variable[iv["iHighBurnupStructurePorosity"]].getValue()))
+	switch (iHighBurnupStructurePorosity)
 	{
 	case 0:
 	{
@@ -37,7 +38,7 @@ void HighBurnupStructurePorosity()
 		/// No HBS case - no evolution of HBS porosity
 
 		reference += "not considered";
-		parameter.push_back(0.0);
+		parameter.high_burnup_structure_porosity.porosity_increment = 0.0;
 		sciantix_variable[sv["HBS porosity"]].setInitialValue(0.0);
 		sciantix_variable[sv["HBS porosity"]].setFinalValue(0.0);
 		break;
@@ -69,17 +70,29 @@ void HighBurnupStructurePorosity()
 
 		reference = "based on Spino et al. 2006 data";
 
-		parameter.push_back(porosity_increment);
+		parameter.high_burnup_structure_porosity.porosity_increment = porosity_increment;
 
 		break;
 	}
-
-	default:
-		ErrorMessages::Switch("HighBurnupStructurePorosity.cpp", "HighBurnupStructurePorosity", int(input_variable[iv["HighBurnupStructurePorosity"]].getValue()));
-		break;
 	}
 
 	model[model_index].setParameter(parameter);
 	model[model_index].setRef(reference);
 
-}
\ No newline at end of file
+}
+
+template void HighBurnupStructurePorosity<0>();
+template void HighBurnupStructurePorosity<1>();
+
+ModelDefinition HighBurnupStructurePorosityDefinition(int iHighBurnupStructurePorosity)
+{
+	switch (iHighBurnupStructurePorosity)
+	{
+		case 0: return &HighBurnupStructurePorosity<0>;
+		case 1: return &HighBurnupStructurePorosity<1>;
+
+		default:
+			ErrorMessages::Switch("HighBurnupStructurePorosity.cpp", "HighBurnupStructurePorosity", iHighBurnupStructurePorosity);
+			return nullptr;
+	}
+}
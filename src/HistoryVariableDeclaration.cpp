@@ -22,4 +22,4 @@
 ///
 /// This routines declares the vector of objects "history_variables".
 
-std::vector<HistoryVariable> history_variable;
+thread_local std::vector<HistoryVariable> history_variable;
@@ -22,8 +22,6 @@
 
 void Initialization()
 {
-	const double pi = CONSTANT_NUMBERS_H::MathConstants::pi;
-
 	// Sciantix_history initialization
 	Sciantix_history[0] = Temperature_input[0];
 	Sciantix_history[1] = Temperature_input[0];
@@ -36,6 +34,11 @@ void Initialization()
 	Sciantix_history[9] = Steampressure_input[0];
 	Sciantix_history[10] = Steampressure_input[0];
 
+	InitialConditions(Sciantix_variables, Sciantix_diffusion_modes);
+}
+
+void InitialConditions(double Sciantix_variables[], double Sciantix_diffusion_modes[])
+{
 	// Sciantix_variables initialization
 	Sciantix_variables[25] = 4.0e+13;  // Intergranular_bubble_concentration[0]
 	Sciantix_variables[35] = 0.5;      // Intergranular_saturation_fractional_coverage[0]
@@ -55,12 +58,9 @@ void Initialization()
 	Sciantix_variables[64] = 1.0;
 
 	// projection on diffusion modes of the initial conditions
+	Solver solver;
 	double initial_condition(0.0);
-	double projection_remainder(0.0);
-	double reconstructed_solution(0.0);
-	int iteration(0), iteration_max(20), n(0), np1(1), n_modes(40), k(0), K(20);
-	double projection_coeff(0.0);
-	projection_coeff = -sqrt(8.0 / pi);
+	int n_modes(40), k(0), K(20);
 
 	for (k = 0; k < K; ++k)
 	{
@@ -89,19 +89,7 @@ void Initialization()
 		default: initial_condition = 0.0; break;
 		}
 
-		projection_remainder = initial_condition;
-		for (iteration = 0; iteration < iteration_max; ++iteration)
-		{
-			reconstructed_solution = 0.0;
-			for (n = 0; n < n_modes; ++n)
-			{
-				np1 = n + 1;
-				const double n_coeff = pow(-1.0, np1) / np1;
-				Sciantix_diffusion_modes[k * n_modes + n] += projection_coeff * n_coeff * projection_remainder;
-				reconstructed_solution += projection_coeff * n_coeff * Sciantix_diffusion_modes[k * n_modes + n] * 3.0 / (4.0 * pi);
-			}
-			projection_remainder = initial_condition - reconstructed_solution;
-		}
+		solver.modeInitialization(n_modes, initial_condition, &Sciantix_diffusion_modes[k * n_modes]);
 	}
 
 	// Warnings
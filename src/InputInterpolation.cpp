@@ -21,10 +21,11 @@
 
 #include "InputInterpolation.h"
 
-double InputInterpolation(double x, std::vector<double> xx, std::vector<double> yy, unsigned short int n)
+double InputInterpolation(double x, const std::vector<double>& xx, const std::vector<double>& yy, int n)
 {
+	// The input vectors are passed by reference and indexed with int, to support input histories of any length
 	double y;
-	signed short int interval_low, interval_upp, interval_med, i;
+	int interval_low, interval_upp, interval_med, i;
 	double a, b, c;
 
 	n--;
@@ -72,12 +72,169 @@ std::vector<double> ReadSeveralParameters(std::string variable_name, std::ifstre
 	return vector_read;
 }
 
+void CommandLineReading(int argc, char* argv[])
+{
+	/**
+	 * @brief This routine reads the (optional) command-line arguments of sciantix.x.
+	 * Apart from --property-tables, they do not affect the results of the simulation, which is fully defined by the input files.
+	 * 
+	 * --trace
+	 * 	writes trace.json, a Chrome trace-event file (viewable in Perfetto or chrome://tracing) with the
+	 * 	duration of each time step and of each stage of Sciantix(), together with the time step size,
+	 * 	the Newton iterations and the diffusion modes solved in each time step.
+	 * 
+	 * --perf-counters
+	 * 	writes performance_counters.txt, with the hardware performance counters (cycles, instructions, cache misses,
+	 * 	branch mispredictions) accumulated over each stage of Sciantix() and each solver call (Linux only).
+	 * 
+	 * --solver-output
+	 * 	adds to output.txt, for each iterative solver, the iterations, the largest final residual and the non-converged calls of each time step,
+	 * 	and writes solver_report.txt with the same figures over the whole simulation.
+	 * 
+	 * --property-memo-report
+	 * 	writes property_memo_report.txt, with the hits and misses of the memoised property correlations (PropertyMemo).
+	 * 
+	 * --generic-models
+	 * 	runs the generic sequence of models also when the input settings match an option set with a specialised sequence (ModelSpecialisation).
+	 * 
+	 * --property-tables <tolerance>
+	 * 	interpolates the temperature factors of the Arrhenius correlations (fission gas, helium and grain-boundary vacancy diffusivities,
+	 * 	grain-boundary mobility) from tables built at startup, with a relative error below the tolerance (e.g., 1e-8) (PropertyTable).
+	 * 
+	 * --checkpoint <file>
+	 * 	writes the state of the simulation at its end in the binary checkpoint <file> (Checkpoint).
+	 * 
+	 * --checkpoint-interval <n>
+	 * 	writes a checkpoint also every n time steps, in a file named after the time step (checkpoint_<step>.bin by default).
+	 * 
+	 * --resume <file>
+	 * 	continues the simulation from the state of the checkpoint <file>, appending to output.txt.
+	 * 
+	 * --ensemble <file>
+	 * 	runs concurrently the branches listed in <file> (one directory per line) from the state of the --resume checkpoint (Ensemble).
+	 * 
+	 * --ensemble-threads <n>
+	 * 	runs the branches of the ensemble on n threads (by default, the number of cores).
+	 */
+
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string argument(argv[i]);
+
+		if (argument == "--trace")
+			Trace_output = true;
+
+		else if (argument == "--perf-counters")
+			Performance_counters_output = true;
+
+		else if (argument == "--solver-output")
+			Solver_output = true;
+
+		else if (argument == "--property-memo-report")
+			Property_memo_output = true;
+
+		else if (argument == "--generic-models")
+			Specialised_models = false;
+
+		else if (argument == "--property-tables")
+		{
+			char* end(NULL);
+			const double tolerance = (i + 1 < argc) ? strtod(argv[i + 1], &end) : 0.0;
+
+			if (end == NULL || *end != '\0' || !(tolerance > 0.0 && tolerance < 1.0))
+				ErrorMessages::CommandLine(i + 1 < argc ? argument + " " + argv[i + 1] : argument);
+
+			PropertyTables(tolerance);
+			++i;
+		}
+
+		else if (argument == "--checkpoint" || argument == "--resume" || argument == "--ensemble")
+		{
+			if (i + 1 >= argc)
+				ErrorMessages::CommandLine(argument);
+
+			if (argument == "--checkpoint")
+				Checkpoint_file = argv[i + 1];
+			else if (argument == "--resume")
+				Resume_file = argv[i + 1];
+			else
+				Ensemble_file = argv[i + 1];
+			++i;
+		}
+
+		else if (argument == "--ensemble-threads")
+		{
+			char* end(NULL);
+			const long int threads = (i + 1 < argc) ? strtol(argv[i + 1], &end, 10) : 0;
+
+			if (end == NULL || *end != '\0' || threads <= 0)
+				ErrorMessages::CommandLine(i + 1 < argc ? argument + " " + argv[i + 1] : argument);
+
+			Ensemble_threads = int(threads);
+			++i;
+		}
+
+		else if (argument == "--checkpoint-interval")
+		{
+			char* end(NULL);
+			const long long int interval = (i + 1 < argc) ? strtoll(argv[i + 1], &end, 10) : 0;
+
+			if (end == NULL || *end != '\0' || interval <= 0)
+				ErrorMessages::CommandLine(i + 1 < argc ? argument + " " + argv[i + 1] : argument);
+
+			Checkpoint_interval = interval;
+			++i;
+		}
+
+		else
+			ErrorMessages::CommandLine(argument);
+	}
+
+	if (Checkpoint_interval > 0 && Checkpoint_file.empty())
+		Checkpoint_file = "checkpoint.bin";
+}
+
+static void InputFileOpen(std::ifstream& input_file, const std::string& file_name)
+{
+	/// The input files are looked for in the directory of the simulation (Simulation_directory)
+	/// and, when missing there, in the working directory.
+	input_file.open(Simulation_directory + file_name);
+
+	if (input_file.fail() && !Simulation_directory.empty())
+	{
+		input_file.clear();
+		input_file.open(file_name);
+	}
+}
+
 void InputReading()
 {
 	/// Besides the two input files, this routines creates an input_check.txt file
 	/// reporting all the inputs provided in the other files.
 	/// It is highly recommended checking this file, since eventual errors
 	/// are reported in it.
+	/// The state of the simulation is reset before reading, so that the simulation is fully defined by the input files
+	/// also when several simulations are run in the same process.
+
+	std::fill(Sciantix_options, Sciantix_options + 40, 0);
+	std::fill(Sciantix_history, Sciantix_history + 20, 0.0);
+	std::fill(Sciantix_variables, Sciantix_variables + 300, 0.0);
+	std::fill(Sciantix_scaling_factors, Sciantix_scaling_factors + 10, 0.0);
+	std::fill(Sciantix_diffusion_modes, Sciantix_diffusion_modes + 1000, 0.0);
+
+	Time_step_number = 0;
+	Time_h = 0.0;
+	dTime_h = 0.0;
+	Time_end_h = 0.0;
+	Time_s = 0.0;
+	Time_end_s = 0.0;
+
+	Input_history_points = 0;
+	Time_input.clear();
+	Temperature_input.clear();
+	Fissionrate_input.clear();
+	Hydrostaticstress_input.clear();
+	Steampressure_input.clear();
 
 	std::ifstream input_settings;
 	std::ifstream input_initial_conditions;
@@ -85,11 +242,11 @@ void InputReading()
 	std::ifstream input_scaling_factors;
 	std::ofstream input_check;
 
-	input_check.open("input_check.txt", std::ios::out);
-	input_settings.open("input_settings.txt");
-	input_initial_conditions.open("input_initial_conditions.txt");
-	input_history.open("input_history.txt");
-	input_scaling_factors.open("input_scaling_factors.txt");
+	input_check.open(Simulation_directory + "input_check.txt", std::ios::out);
+	InputFileOpen(input_settings, "input_settings.txt");
+	InputFileOpen(input_initial_conditions, "input_initial_conditions.txt");
+	InputFileOpen(input_history, "input_history.txt");
+	InputFileOpen(input_scaling_factors, "input_scaling_factors.txt");
 
 	/**
 	 * @brief
@@ -283,38 +440,54 @@ void InputReading()
 		Sciantix_variables[66] = ReadOneParameter("Initial stoichiometry deviation[0]", input_initial_conditions, input_check);
 	}
 
-	int n = 0;
-	while (!input_history.eof())
+	/// The input history can have any number of time points (e.g., long synthetic histories, see utilities/syntheticHistory).
+	/// The steam pressure is read only with iStoichiometryDeviation > 0, otherwise it is set to zero.
+	/// Each non-blank line is one time point: a short row, a non-numeric field or a time lower than the
+	/// previous one stops the simulation, since TimeStepCalculation bisects the columns by time.
+	double time(0.0), temperature(0.0), fission_rate(0.0), hydrostatic_stress(0.0), steam_pressure(0.0);
+	std::string history_line;
+	int history_row(0);
+	while (std::getline(input_history, history_line))
 	{
-		input_history >> Time_input[n];
-		input_history >> Temperature_input[n];
-		input_history >> Fissionrate_input[n];
-		input_history >> Hydrostaticstress_input[n];
+		++history_row;
+		if (history_line.find_first_not_of(" \t\r") == std::string::npos)
+			continue;
+
+		std::istringstream history_fields(history_line);
+		history_fields >> time >> temperature >> fission_rate >> hydrostatic_stress;
 
 		if(Sciantix_options[21] > 0)
-			input_history >> Steampressure_input[n];
+			history_fields >> steam_pressure;
+
+		if (history_fields.fail())
+			ErrorMessages::InputHistory(history_row, (Sciantix_options[21] > 0) ?
+				"does not contain 5 numeric fields (time, temperature, fission rate, hydrostatic stress, steam pressure)" :
+				"does not contain 4 numeric fields (time, temperature, fission rate, hydrostatic stress)");
+
+		if (!Time_input.empty() && time < Time_input.back())
+			ErrorMessages::InputHistory(history_row, "has a time lower than the previous row");
 
-		input_check << Time_input[n] << "\t";
-		input_check << Temperature_input[n] << "\t";
-		input_check << Fissionrate_input[n] << "\t";
-		input_check << Hydrostaticstress_input[n] << "\t";
+		Time_input.push_back(time);
+		Temperature_input.push_back(temperature);
+		Fissionrate_input.push_back(fission_rate);
+		Hydrostaticstress_input.push_back(hydrostatic_stress);
+		Steampressure_input.push_back(steam_pressure);
+
+		input_check << time << "\t";
+		input_check << temperature << "\t";
+		input_check << fission_rate << "\t";
+		input_check << hydrostatic_stress << "\t";
 
 		if(Sciantix_options[21] > 0)
-			input_check << Steampressure_input[n] << "\t";
+			input_check << steam_pressure << "\t";
 
 		input_check << std::endl;
-
-		n++;
-		Input_history_points = n;
 	}
 
-	Time_input.resize(Input_history_points);
-	Temperature_input.resize(Input_history_points);
-	Fissionrate_input.resize(Input_history_points);
-	Hydrostaticstress_input.resize(Input_history_points);
-		
-	if(Sciantix_options[21] > 0)
-		Steampressure_input.resize(Input_history_points);
+	Input_history_points = int(Time_input.size());
+
+	if (Input_history_points == 0)
+		ErrorMessages::EmptyInputHistory();
 
 	Time_end_h = Time_input[Input_history_points - 1];
 	Time_end_s = Time_end_h * 3600.0;
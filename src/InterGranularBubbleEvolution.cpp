@@ -25,6 +25,7 @@
 
 #include "InterGranularBubbleEvolution.h"
 
+template <int iGrainBoundaryBehaviour>
 void InterGranularBubbleEvolution()
 {
 	model.emplace_back();
@@ -32,20 +33,20 @@ void InterGranularBubbleEvolution()
 
 	model[model_index].setName("Intergranular bubble evolution");
 	std::string reference;
-	std::vector<double> parameter;
+	ModelParameter parameter;
 	
 	const double pi = CONSTANT_NUMBERS_H::MathConstants::pi;
 	const double boltzmann_constant = CONSTANT_NUMBERS_H::PhysicsConstants::boltzmann_constant;
 
-	if (input_variable[iv["iGrainBoundaryBehaviour"]].getValue() == 0)
+	if (iGrainBoundaryBehaviour == 0)
 	{
-		parameter.push_back(0.0);
-		parameter.push_back(0.0);
+		parameter.intergranular_bubble_evolution.growth_rate = 0.0;
+		parameter.intergranular_bubble_evolution.source_term = 0.0;
 
 		reference += ": No model for grain-boundary bubble evolution.";
 	}
 
-	else if (input_variable[iv["iGrainBoundaryBehaviour"]].getValue() == 1)
+	else if (iGrainBoundaryBehaviour == 1)
 	{
 		// Gas is distributed among bubbles
 		// n(at/bub) = c(at/m3) / (N(bub/m2) S/V(1/m))
@@ -120,8 +121,8 @@ void InterGranularBubbleEvolution()
 				(boltzmann_constant * history_variable[hv["Temperature"]].getFinalValue());
 		}
 
-		parameter.push_back(growth_rate);
-		parameter.push_back(equilibrium_term);
+		parameter.intergranular_bubble_evolution.growth_rate = growth_rate;
+		parameter.intergranular_bubble_evolution.source_term = equilibrium_term;
 
 		reference += ": Pastore et al., NED, 256 (2013) 75-86.";
 	}
@@ -129,3 +130,19 @@ void InterGranularBubbleEvolution()
 	model[model_index].setParameter(parameter);
 	model[model_index].setRef(reference);
 }
+
+template void InterGranularBubbleEvolution<0>();
+template void InterGranularBubbleEvolution<1>();
+
+ModelDefinition InterGranularBubbleEvolutionDefinition(int iGrainBoundaryBehaviour)
+{
+	switch (iGrainBoundaryBehaviour)
+	{
+		case 0: return &InterGranularBubbleEvolution<0>;
+		case 1: return &InterGranularBubbleEvolution<1>;
+
+		default:
+			ErrorMessages::Switch("InterGranularBubbleEvolution.cpp", "iGrainBoundaryBehaviour", iGrainBoundaryBehaviour);
+			return nullptr;
+	}
+}
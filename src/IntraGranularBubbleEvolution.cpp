@@ -16,6 +16,7 @@
 
 #include "IntraGranularBubbleEvolution.h"
 
+template <int iIntraGranularBubbleEvolution>
 void IntraGranularBubbleEvolution()
 {
 	/// @brief
@@ -27,9 +28,9 @@ void IntraGranularBubbleEvolution()
 	model[model_index].setName("Intragranular bubble evolution");
 
 	std::string reference;
-	std::vector<double> parameter;
+	ModelParameter parameter;
 
-	switch (int(input_variable[iv["iIntraGranularBubbleEvolution"]].getValue()))
+	switch (iIntraGranularBubbleEvolution)
 	{
 	case 0:
 	{
@@ -49,8 +50,8 @@ void IntraGranularBubbleEvolution()
 		sciantix_variable[sv["Intragranular bubble concentration"]].setFinalValue(7.0e23);
 		sciantix_variable[sv["Intragranular bubble radius"]].setFinalValue(1.0e-9);
 
-		parameter.push_back(0.);
-		parameter.push_back(0.);
+		parameter.intragranular_bubble_evolution.decay_rate = 0.;
+		parameter.intragranular_bubble_evolution.source_term = 0.;
 
 		break;
 	}
@@ -69,10 +70,10 @@ void IntraGranularBubbleEvolution()
 		reference += "Pizzocri et al., JNM, 502 (2018) 323-330.";
 
 		/// @param[in] resolution_rate
-		parameter.push_back(sciantix_system[sy["Xe in UO2"]].getResolutionRate());
+		parameter.intragranular_bubble_evolution.decay_rate = sciantix_system[sy["Xe in UO2"]].getResolutionRate();
 
 		/// @param[in] nucleation_rate
-		parameter.push_back(sciantix_system[sy["Xe in UO2"]].getNucleationRate());
+		parameter.intragranular_bubble_evolution.source_term = sciantix_system[sy["Xe in UO2"]].getNucleationRate();
 
 		break;
 	}
@@ -90,8 +91,8 @@ void IntraGranularBubbleEvolution()
 		reference += "White and Tucker, JNM, 118 (1983), 1-38.";
 		
 		sciantix_variable[sv["Intragranular bubble concentration"]].setInitialValue(1.52e+27 / history_variable[hv["Temperature"]].getFinalValue() - 3.3e+23);
-		parameter.push_back(0.0);
-		parameter.push_back(0.0);
+		parameter.intragranular_bubble_evolution.decay_rate = 0.0;
+		parameter.intragranular_bubble_evolution.source_term = 0.0;
 		break;
 	}
 
@@ -107,11 +108,11 @@ void IntraGranularBubbleEvolution()
 		reference += "Case specific for annealing experiments and helium intragranular behaviour.";
 
 		if(physics_variable[pv["Time step"]].getFinalValue() > 0.0)
-			parameter.push_back((1.0 / sciantix_variable[sv["Intragranular similarity ratio"]].getFinalValue() - 1.0) / physics_variable[pv["Time step"]].getFinalValue());
+			parameter.intragranular_bubble_evolution.decay_rate = (1.0 / sciantix_variable[sv["Intragranular similarity ratio"]].getFinalValue() - 1.0) / physics_variable[pv["Time step"]].getFinalValue();
 		else
-			parameter.push_back(0.);
+			parameter.intragranular_bubble_evolution.decay_rate = 0.;
 
-		parameter.push_back(0.);
+		parameter.intragranular_bubble_evolution.source_term = 0.;
 
 		break;
 	}
@@ -139,15 +140,11 @@ void IntraGranularBubbleEvolution()
 		sciantix_variable[sv["Intragranular bubble radius"]].setFinalValue(0.0);
 		sciantix_variable[sv["Intragranular atoms per bubble"]].setFinalValue(0.0);
 
-		parameter.push_back(0.);
-		parameter.push_back(0.);
+		parameter.intragranular_bubble_evolution.decay_rate = 0.;
+		parameter.intragranular_bubble_evolution.source_term = 0.;
 
 		break;
 	}
-
-	default:
-		ErrorMessages::Switch("IntraGranularBubbleEvolution.cpp", "iIntraGranularBubbleEvolution", int(input_variable[iv["iIntraGranularBubbleEvolution"]].getValue()));
-		break;
 	}
 
 	model[model_index].setParameter(parameter);
@@ -155,4 +152,24 @@ void IntraGranularBubbleEvolution()
 
 }
 
+template void IntraGranularBubbleEvolution<0>();
+template void IntraGranularBubbleEvolution<1>();
+template void IntraGranularBubbleEvolution<2>();
+template void IntraGranularBubbleEvolution<3>();
+template void IntraGranularBubbleEvolution<99>();
 
+ModelDefinition IntraGranularBubbleEvolutionDefinition(int iIntraGranularBubbleEvolution)
+{
+	switch (iIntraGranularBubbleEvolution)
+	{
+		case 0: return &IntraGranularBubbleEvolution<0>;
+		case 1: return &IntraGranularBubbleEvolution<1>;
+		case 2: return &IntraGranularBubbleEvolution<2>;
+		case 3: return &IntraGranularBubbleEvolution<3>;
+		case 99: return &IntraGranularBubbleEvolution<99>;
+
+		default:
+			ErrorMessages::Switch("IntraGranularBubbleEvolution.cpp", "iIntraGranularBubbleEvolution", iIntraGranularBubbleEvolution);
+			return nullptr;
+	}
+}
@@ -16,25 +16,38 @@
 
 #include "MainVariables.h"
 
-clock_t timer, timer_time_step;
+thread_local clock_t timer, timer_time_step;
 
-int    Sciantix_options[40];
-double Sciantix_history[20];
-double Sciantix_variables[300];
-double Sciantix_scaling_factors[10];
-double Sciantix_diffusion_modes[1000];
+thread_local int    Sciantix_options[40];
+thread_local double Sciantix_history[20];
+thread_local double Sciantix_variables[300];
+thread_local double Sciantix_scaling_factors[10];
+thread_local double Sciantix_diffusion_modes[1000];
 
-long long int Time_step_number(0);
-double  Time_h(0.0), dTime_h(0.0), Time_end_h(0.0); // (h)
-double  Time_s(0.0), Time_end_s(0.0); // (s)
-double  Number_of_time_steps_per_interval(100);
+thread_local long long int Time_step_number(0);
+thread_local double  Time_h(0.0), dTime_h(0.0), Time_end_h(0.0); // (h)
+thread_local double  Time_s(0.0), Time_end_s(0.0); // (s)
+thread_local double  Number_of_time_steps_per_interval(100);
+thread_local std::string Simulation_directory;
+thread_local bool Output_txt(true);
 
-std::ofstream Output_file;
-std::ofstream Execution_file;
+bool Trace_output(false);
+bool Performance_counters_output(false);
+bool Solver_output(false);
+bool Property_memo_output(false);
+bool Specialised_models(true);
+std::string Checkpoint_file;
+long long int Checkpoint_interval(0);
+std::string Resume_file;
+std::string Ensemble_file;
+int Ensemble_threads(0);
 
-int Input_history_points(1000);
-std::vector<double> Time_input(1000, 0.0);
-std::vector<double> Temperature_input(1000, 0.0);
-std::vector<double> Fissionrate_input(1000, 0.0);
-std::vector<double> Hydrostaticstress_input(1000, 0.0);
-std::vector<double> Steampressure_input(1000, 0.0);
\ No newline at end of file
+thread_local std::ofstream Output_file;
+thread_local std::ofstream Execution_file;
+
+thread_local int Input_history_points(0);
+thread_local std::vector<double> Time_input;
+thread_local std::vector<double> Temperature_input;
+thread_local std::vector<double> Fissionrate_input;
+thread_local std::vector<double> Hydrostaticstress_input;
+thread_local std::vector<double> Steampressure_input;
\ No newline at end of file
@@ -16,7 +16,7 @@
 
 #include "MapGas.h"
 
-std::map<std::string, int> ga;
+thread_local std::map<std::string, int> ga;
 
 void MapGas()
 {
@@ -16,7 +16,7 @@
 
 #include "MapHistoryVariable.h"
 
-std::map<std::string, int> hv;
+thread_local std::map<std::string, int> hv;
 
 void MapHistoryVariable()
 {
@@ -19,7 +19,7 @@
 /// MapInputVariable
 /// Map for InputVariable
 
-std::map<std::string, int> iv;
+thread_local std::map<std::string, int> iv;
 
 void MapInputVariable()
 {
@@ -18,7 +18,7 @@
 
 /// MapModel
 
-std::map<std::string, int> sma;
+thread_local std::map<std::string, int> sma;
 
 void MapMatrix()
 {
@@ -18,7 +18,7 @@
 
 /// MapModel
 
-std::map<std::string, int> sm;
+thread_local std::map<std::string, int> sm;
 
 void MapModel()
 {
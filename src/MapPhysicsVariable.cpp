@@ -16,7 +16,7 @@
 
 #include "MapPhysicsVariable.h"
 
-std::map<std::string, int> pv;
+thread_local std::map<std::string, int> pv;
 
 void MapPhysicsVariable()
 {
@@ -21,7 +21,7 @@
  * 
  */
 
-std::map<std::string, int> sv;
+thread_local std::map<std::string, int> sv;
 
 void MapSciantixVariable()
 {
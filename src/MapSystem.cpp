@@ -21,7 +21,7 @@
  * 
  */
 
-std::map<std::string, int> sy;
+thread_local std::map<std::string, int> sy;
 
 void MapSystem()
 {
@@ -21,4 +21,4 @@
  * 
  */
 
-std::vector<Material> material;
+thread_local std::vector<Material> material;
@@ -17,4 +17,4 @@
 
 /// MatrixDeclaration
 
-std::vector<Matrix> matrix;
\ No newline at end of file
+thread_local std::vector<Matrix> matrix;
\ No newline at end of file
@@ -18,5 +18,5 @@
 
 /// ModelDeclaration
 
-std::vector<Model> model;
+thread_local std::vector<Model> model;
 
@@ -0,0 +1,136 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+/// ModelRegistry
+/// This routine declares the models of the SCIANTIX time step, in their order of execution.
+/// Each model lists the variables it reads and writes, '*' standing for any part of the name (e.g., "* produced" for the gas produced of every system).
+/// The diffusion modes, which are not sciantix variables, are declared as "Diffusion modes".
+/// The declarations of the sciantix variables and of the diffusion modes written are verified by the check build (ScheduleCheck).
+/// The input options of each model are resolved here, once per simulation, into the routines to call at each time step.
+/// A new model is added to SCIANTIX by declaring it here, at the position of its execution.
+
+#include "ModelRegistry.h"
+
+static int Option(const std::string& name)
+{
+	return int(input_variable[iv[name]].getValue());
+}
+
+static bool StoichiometryDeviationActive()
+{
+	return input_variable[iv["iStoichiometryDeviation"]].getValue() != 0;
+}
+
+static bool HighBurnupStructureFormationActive()
+{
+	return int(input_variable[iv["iHighBurnupStructureFormation"]].getValue()) != 0;
+}
+
+static bool GrainBoundarySweepingActive()
+{
+	return int(input_variable[iv["iGrainBoundarySweeping"]].getValue()) != 0;
+}
+
+static bool GrainBoundaryMicroCrackingActive()
+{
+	return input_variable[iv["iGrainBoundaryMicroCracking"]].getValue() != 0;
+}
+
+static bool GrainBoundaryVentingActive()
+{
+	return int(input_variable[iv["iGrainBoundaryVenting"]].getValue()) != 0;
+}
+
+std::vector<RegisteredModel> ModelRegistry()
+{
+	std::vector<RegisteredModel> registry = {
+		{ "Burnup", Burnup, &Simulation::Burnup, nullptr,
+			{ "Fission rate", "Fuel density", "U" },
+			{ "Specific power", "Burnup", "Irradiation time", "FIMA" } },
+
+		{ "EffectiveBurnup", EffectiveBurnup, &Simulation::EffectiveBurnup, nullptr,
+			{ "Temperature", "Specific power" },
+			{ "Effective burnup" } },
+
+		{ "EnvironmentComposition", EnvironmentComposition, nullptr, StoichiometryDeviationActive,
+			{ "Temperature", "Steam pressure" },
+			{ "Gap oxygen partial pressure" } },
+
+		{ "UO2Thermochemistry", UO2Thermochemistry, &Simulation::UO2Thermochemistry, StoichiometryDeviationActive,
+			{ "Temperature", "Stoichiometry deviation", "Gap oxygen partial pressure" },
+			{ "Equilibrium stoichiometry deviation" } },
+
+		{ "StoichiometryDeviation", StoichiometryDeviationDefinition(Option("iStoichiometryDeviation")),
+			Simulation::StoichiometryDeviationStep(Option("iStoichiometryDeviation")), StoichiometryDeviationActive,
+			{ "Temperature", "Steam pressure", "Grain radius", "Gap oxygen partial pressure", "Equilibrium stoichiometry deviation" },
+			{ "Stoichiometry deviation", "Fuel oxygen partial pressure" } },
+
+		{ "HighBurnupStructureFormation", HighBurnupStructureFormationDefinition(Option("iHighBurnupStructureFormation")),
+			&Simulation::HighBurnupStructureFormation, HighBurnupStructureFormationActive,
+			{ "Temperature", "Fission rate", "Effective burnup" },
+			{ "Restructured volume fraction" } },
+
+		// Always active: with iHighBurnupStructurePorosity = 0 the definition resets the HBS porosity, and there is nothing to solve
+		{ "HighBurnupStructurePorosity", HighBurnupStructurePorosityDefinition(Option("iHighBurnupStructurePorosity")),
+			Simulation::HighBurnupStructurePorosityStep(Option("iHighBurnupStructurePorosity")), nullptr,
+			{ "Burnup" },
+			{ "HBS porosity", "Fuel density" } },
+
+		{ "GrainGrowth", GrainGrowthDefinition(Option("iGrainGrowth")), &Simulation::GrainGrowth, nullptr,
+			{ "Temperature", "Burnup" },
+			{ "Grain radius" } },
+
+		{ "GrainBoundarySweeping", GrainBoundarySweepingDefinition(Option("iGrainBoundarySweeping")),
+			Simulation::GrainBoundarySweepingStep(Option("iDiffusionSolver")), GrainBoundarySweepingActive,
+			{ "Grain radius" },
+			{ "Diffusion modes" } },
+
+		{ "GasProduction", GasProduction, &Simulation::GasProduction, nullptr,
+			{ "Fission rate" },
+			{ "* produced" } },
+
+		{ "GasDecay", nullptr, &Simulation::GasDecay, nullptr,
+			{ "* produced" },
+			{ "* decayed" } },
+
+		{ "IntraGranularBubbleEvolution", IntraGranularBubbleEvolutionDefinition(Option("iIntraGranularBubbleEvolution")), &Simulation::IntraGranularBubbleBehaviour, nullptr,
+			{ "Temperature", "Fission rate", "* in intragranular bubbles" },
+			{ "Intragranular *" } },
+
+		{ "GasDiffusion", GasDiffusionDefinition(Option("iDiffusionSolver")),
+			Simulation::GasDiffusionStep(Option("iDiffusionSolver"), Option("iGrainBoundaryBehaviour")), nullptr,
+			{ "Temperature", "Fission rate", "Grain radius", "* produced", "* decayed", "Diffusion modes" },
+			{ "* in grain", "* in intragranular solution", "* in intragranular bubbles", "* at grain boundary", "* released", "Diffusion modes" } },
+
+		{ "GrainBoundaryMicroCracking", GrainBoundaryMicroCracking, &Simulation::GrainBoundaryMicroCracking, GrainBoundaryMicroCrackingActive,
+			{ "Temperature", "Burnup", "* produced", "* decayed", "* in grain" },
+			{ "Intergranular fractional intactness", "Intergranular fractional coverage", "Intergranular saturation fractional coverage",
+				"Intergranular atoms per bubble", "Intergranular * atoms per bubble", "Intergranular vacancies per bubble", "Intergranular bubble *",
+				"* at grain boundary", "* released" } },
+
+		{ "GrainBoundaryVenting", GrainBoundaryVentingDefinition(Option("iGrainBoundaryVenting")), &Simulation::GrainBoundaryVenting, GrainBoundaryVentingActive,
+			{ "Intergranular fractional coverage", "Intergranular fractional intactness" },
+			{ "Intergranular vented fraction", "Intergranular venting probability", "* at grain boundary" } },
+
+		{ "InterGranularBubbleEvolution", InterGranularBubbleEvolutionDefinition(Option("iGrainBoundaryBehaviour")),
+			&Simulation::InterGranularBubbleBehaviour, nullptr,
+			{ "Temperature", "Hydrostatic stress", "Grain radius", "* produced", "* decayed", "* in grain", "Intergranular saturation fractional coverage" },
+			{ "Intergranular fractional coverage", "Intergranular atoms per bubble", "Intergranular * atoms per bubble", "Intergranular vacancies per bubble",
+				"Intergranular bubble *", "Intergranular gas swelling", "* at grain boundary", "* released" } },
+	};
+
+	return registry;
+}
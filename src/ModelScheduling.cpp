@@ -0,0 +1,63 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+/// ModelScheduling
+/// This routine builds the schedule of the models of the SCIANTIX time step (model_schedule), once per simulation,
+/// from the model declarations (ModelRegistry) and the input settings: the models disabled by the input settings are not scheduled,
+/// hence neither defined nor solved at each time step.
+/// The scheduled models are executed sequentially, in the order of the registry. The variables declared in the registry would allow
+/// running independent models concurrently, but the state of a simulation is thread_local (so that simulations run concurrently, one per thread),
+/// the heaviest models (GasDiffusion, InterGranularBubbleEvolution) are on the chain of dependencies of every other model, and the models
+/// off that chain (e.g., GasProduction, GasDecay, IntraGranularBubbleEvolution) take a few microseconds per time step, less than handing them
+/// to another thread and waiting for it. The declarations are verified instead (ScheduleCheck).
+
+#include "ModelScheduling.h"
+
+thread_local std::vector<RegisteredModel> model_schedule;
+
+void ModelScheduling()
+{
+	model_schedule.clear();
+
+	std::vector<RegisteredModel> registry = ModelRegistry();
+	for (std::vector<RegisteredModel>::size_type i = 0; i != registry.size(); ++i)
+	{
+		if (registry[i].active == nullptr || registry[i].active())
+			model_schedule.push_back(registry[i]);
+	}
+}
+
+void ScheduledModels(Simulation& sciantix_simulation)
+{
+	for (std::vector<RegisteredModel>::size_type i = 0; i != model_schedule.size(); ++i)
+	{
+		StageBegin(model_schedule[i].name);
+#ifdef SCIANTIX_SCHEDULE_CHECK
+		ScheduleCheckBegin();
+#endif
+		if (model_schedule[i].definition)
+		{
+			model_schedule[i].definition();
+			MapModel();
+		}
+		if (model_schedule[i].simulation)
+			(sciantix_simulation.*model_schedule[i].simulation)();
+#ifdef SCIANTIX_SCHEDULE_CHECK
+		ScheduleCheckModel(model_schedule[i]);
+#endif
+		StageEnd(model_schedule[i].name);
+	}
+}
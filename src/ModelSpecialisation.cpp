@@ -0,0 +1,188 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+/// ModelSpecialisation
+/// This routine selects, once per simulation, the sequence of models of the time step. If the input settings match an option set
+/// with a specialised sequence (e.g., White2004OptionSet), the sequence is an instantiation of SpecialisedModels, where each model
+/// is defined and solved by a direct call, with its options as template constants. Otherwise, the sequence is the generic ScheduledModels.
+/// The two sequences give the same results: the specialised one can be disabled by the command-line argument --generic-models.
+
+#include "ModelSpecialisation.h"
+
+thread_local ModelSequence model_sequence = ScheduledModels;
+thread_local const char* model_specialisation = "";
+
+/// Same models, in the same order and under the same conditions, of ModelRegistry (ModelScheduling)
+template <class OptionSet>
+static void SpecialisedModels(Simulation& sciantix_simulation)
+{
+	StageBegin("Burnup");
+	Burnup();
+	MapModel();
+	sciantix_simulation.Burnup();
+	StageEnd("Burnup");
+
+	StageBegin("EffectiveBurnup");
+	EffectiveBurnup();
+	MapModel();
+	sciantix_simulation.EffectiveBurnup();
+	StageEnd("EffectiveBurnup");
+
+	if (OptionSet::iStoichiometryDeviation != 0)
+	{
+		StageBegin("EnvironmentComposition");
+		EnvironmentComposition();
+		MapModel();
+		StageEnd("EnvironmentComposition");
+
+		StageBegin("UO2Thermochemistry");
+		UO2Thermochemistry();
+		MapModel();
+		sciantix_simulation.UO2Thermochemistry();
+		StageEnd("UO2Thermochemistry");
+
+		StageBegin("StoichiometryDeviation");
+		StoichiometryDeviation<OptionSet::iStoichiometryDeviation>();
+		MapModel();
+		sciantix_simulation.StoichiometryDeviation<(OptionSet::iStoichiometryDeviation > 4) ? 5 : 1>();
+		StageEnd("StoichiometryDeviation");
+	}
+
+	if (OptionSet::iHighBurnupStructureFormation != 0)
+	{
+		StageBegin("HighBurnupStructureFormation");
+		HighBurnupStructureFormation<OptionSet::iHighBurnupStructureFormation>();
+		MapModel();
+		sciantix_simulation.HighBurnupStructureFormation();
+		StageEnd("HighBurnupStructureFormation");
+	}
+
+	StageBegin("HighBurnupStructurePorosity");
+	HighBurnupStructurePorosity<OptionSet::iHighBurnupStructurePorosity>();
+	MapModel();
+	if (OptionSet::iHighBurnupStructurePorosity != 0)
+		sciantix_simulation.HighBurnupStructurePorosity();
+	StageEnd("HighBurnupStructurePorosity");
+
+	StageBegin("GrainGrowth");
+	GrainGrowth<OptionSet::iGrainGrowth>();
+	MapModel();
+	sciantix_simulation.GrainGrowth();
+	StageEnd("GrainGrowth");
+
+	// Condition of GrainBoundarySweepingActive
+	if (OptionSet::iGrainBoundarySweeping != 0)
+	{
+		StageBegin("GrainBoundarySweeping");
+		GrainBoundarySweeping<OptionSet::iGrainBoundarySweeping>();
+		MapModel();
+		sciantix_simulation.GrainBoundarySweeping<OptionSet::iDiffusionSolver>();
+		StageEnd("GrainBoundarySweeping");
+	}
+
+	StageBegin("GasProduction");
+	GasProduction();
+	MapModel();
+	sciantix_simulation.GasProduction();
+	StageEnd("GasProduction");
+
+	StageBegin("GasDecay");
+	sciantix_simulation.GasDecay();
+	StageEnd("GasDecay");
+
+	StageBegin("IntraGranularBubbleEvolution");
+	IntraGranularBubbleEvolution<OptionSet::iIntraGranularBubbleEvolution>();
+	MapModel();
+	sciantix_simulation.IntraGranularBubbleBehaviour();
+	StageEnd("IntraGranularBubbleEvolution");
+
+	StageBegin("GasDiffusion");
+	GasDiffusion<OptionSet::iDiffusionSolver>();
+	MapModel();
+	sciantix_simulation.GasDiffusion<OptionSet::iDiffusionSolver, (OptionSet::iGrainBoundaryBehaviour == 0) ? 0 : 1>();
+	StageEnd("GasDiffusion");
+
+	if (OptionSet::iGrainBoundaryMicroCracking != 0)
+	{
+		StageBegin("GrainBoundaryMicroCracking");
+		GrainBoundaryMicroCracking();
+		MapModel();
+		sciantix_simulation.GrainBoundaryMicroCracking();
+		StageEnd("GrainBoundaryMicroCracking");
+	}
+
+	if (OptionSet::iGrainBoundaryVenting != 0)
+	{
+		StageBegin("GrainBoundaryVenting");
+		GrainBoundaryVenting<OptionSet::iGrainBoundaryVenting>();
+		MapModel();
+		sciantix_simulation.GrainBoundaryVenting();
+		StageEnd("GrainBoundaryVenting");
+	}
+
+	StageBegin("InterGranularBubbleEvolution");
+	InterGranularBubbleEvolution<OptionSet::iGrainBoundaryBehaviour>();
+	MapModel();
+	sciantix_simulation.InterGranularBubbleBehaviour();
+	StageEnd("InterGranularBubbleEvolution");
+}
+
+template <class OptionSet>
+static bool OptionSetMatches()
+{
+	const std::string name[] = {
+		"iGrainGrowth", "iFGDiffusionCoefficient", "iDiffusionSolver", "iIntraGranularBubbleEvolution", "iResolutionRate",
+		"iTrappingRate", "iNucleationRate", "iOutput", "iGrainBoundaryVacancyDiffusivity", "iGrainBoundaryBehaviour",
+		"iGrainBoundaryMicroCracking", "iFuelMatrix", "iGrainBoundaryVenting", "iRadioactiveFissionGas", "iHelium",
+		"iHeDiffusivity", "iGrainBoundarySweeping", "iHighBurnupStructureFormation", "iHBS_FGDiffusionCoefficient",
+		"iHighBurnupStructurePorosity", "iHeliumProductionRate", "iStoichiometryDeviation", "iBubbleDiffusivity"
+	};
+	const int value[] = {
+		OptionSet::iGrainGrowth, OptionSet::iFGDiffusionCoefficient, OptionSet::iDiffusionSolver, OptionSet::iIntraGranularBubbleEvolution, OptionSet::iResolutionRate,
+		OptionSet::iTrappingRate, OptionSet::iNucleationRate, OptionSet::iOutput, OptionSet::iGrainBoundaryVacancyDiffusivity, OptionSet::iGrainBoundaryBehaviour,
+		OptionSet::iGrainBoundaryMicroCracking, OptionSet::iFuelMatrix, OptionSet::iGrainBoundaryVenting, OptionSet::iRadioactiveFissionGas, OptionSet::iHelium,
+		OptionSet::iHeDiffusivity, OptionSet::iGrainBoundarySweeping, OptionSet::iHighBurnupStructureFormation, OptionSet::iHBS_FGDiffusionCoefficient,
+		OptionSet::iHighBurnupStructurePorosity, OptionSet::iHeliumProductionRate, OptionSet::iStoichiometryDeviation, OptionSet::iBubbleDiffusivity
+	};
+
+	for (int i = 0; i < int(sizeof(value) / sizeof(value[0])); ++i)
+	{
+		if (int(input_variable[iv[name[i]]].getValue()) != value[i])
+			return false;
+	}
+	return true;
+}
+
+template <class OptionSet>
+static bool Specialise()
+{
+	if (!OptionSetMatches<OptionSet>()) return false;
+
+	model_sequence = SpecialisedModels<OptionSet>;
+	model_specialisation = OptionSet::name();
+	return true;
+}
+
+void ModelSpecialisation()
+{
+	model_sequence = ScheduledModels;
+	model_specialisation = "";
+
+	if (!Specialised_models) return;
+
+	if (Specialise<White2004OptionSet>()) return;
+	if (Specialise<Talip2014OptionSet>()) return;
+}
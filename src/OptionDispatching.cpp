@@ -0,0 +1,53 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+/// OptionDispatching
+/// This routine resolves the input settings (input_variable), once per simulation, into the setters of the
+/// matrix and system properties and into the flags of the output. The input values are checked here:
+/// an option out of range stops the simulation at the first time step, and the time step itself
+/// neither looks up nor checks the input settings. The models to run, with their options, are resolved by ModelScheduling.
+
+#include "OptionDispatching.h"
+#include "SetMatrix.h"
+#include "SetSystem.h"
+
+thread_local OptionDispatch option_dispatch;
+
+void OptionDispatching()
+{
+	option_dispatch.set_matrix = SetMatrixDefinition(int(input_variable[iv["iFuelMatrix"]].getValue()));
+	option_dispatch.set_system = SetSystemDefinition(int(input_variable[iv["iFuelMatrix"]].getValue()));
+
+	option_dispatch.grain_boundary_mobility = Matrix::GrainBoundaryMobilitySetter(int(input_variable[iv["iGrainGrowth"]].getValue()));
+	option_dispatch.grain_boundary_vacancy_diffusivity = Matrix::GrainBoundaryVacancyDiffusivitySetter(int(input_variable[iv["iGrainBoundaryVacancyDiffusivity"]].getValue()));
+
+	option_dispatch.fission_gas_diffusivity = System::FissionGasDiffusivitySetter(int(input_variable[iv["iFGDiffusionCoefficient"]].getValue()));
+	option_dispatch.helium_diffusivity = System::HeliumDiffusivitySetter(int(input_variable[iv["iHeDiffusivity"]].getValue()));
+	option_dispatch.bubble_diffusivity = System::BubbleDiffusivitySetter(int(input_variable[iv["iBubbleDiffusivity"]].getValue()));
+	option_dispatch.resolution_rate = System::ResolutionRateSetter(int(input_variable[iv["iResolutionRate"]].getValue()));
+	option_dispatch.trapping_rate = System::TrappingRateSetter(int(input_variable[iv["iTrappingRate"]].getValue()));
+	option_dispatch.nucleation_rate = System::NucleationRateSetter(int(input_variable[iv["iNucleationRate"]].getValue()));
+	option_dispatch.helium_production_rate = System::ProductionRateSetter(int(input_variable[iv["iHeliumProductionRate"]].getValue()));
+
+	option_dispatch.output_radioactive_fission_gas = input_variable[iv["iRadioactiveFissionGas"]].getValue() != 0;
+	option_dispatch.output_venting = input_variable[iv["iGrainBoundaryVenting"]].getValue() != 0;
+	option_dispatch.output_helium = input_variable[iv["iHelium"]].getValue() != 0;
+	option_dispatch.output_cracking = input_variable[iv["iGrainBoundaryMicroCracking"]].getValue() != 0;
+	option_dispatch.output_grain_boundary = input_variable[iv["iGrainBoundaryBehaviour"]].getValue() == 1;
+	option_dispatch.output_high_burnup_structure_formation = input_variable[iv["iHighBurnupStructureFormation"]].getValue() == 1;
+	option_dispatch.output_stoichiometry_deviation = input_variable[iv["iStoichiometryDeviation"]].getValue() > 0;
+	option_dispatch.output_format = int(input_variable[iv["iOutput"]].getValue());
+}
@@ -28,6 +28,27 @@ inline bool if_exist(const std::string& name)
 	return (stat(name.c_str(), &buffer) == 0);
 }
 
+/// With --solver-output, the convergence of the iterative solvers in the time step is appended to the variables (same columns for both output formats).
+static void SolverOutputHeader(std::fstream& output_file)
+{
+	for (int s = 0; s < ITERATIVE_SOLVERS; ++s)
+	{
+		output_file << Solver::IterativeSolverName(s) << " iterations (/)" << "\t";
+		output_file << Solver::IterativeSolverName(s) << " max residual (/)" << "\t";
+		output_file << Solver::IterativeSolverName(s) << " non-converged calls (/)" << "\t";
+	}
+}
+
+static void SolverOutputValues(std::fstream& output_file)
+{
+	for (int s = 0; s < ITERATIVE_SOLVERS; ++s)
+	{
+		output_file << solver.step_convergence[s].iterations << "\t";
+		output_file << std::setprecision(7) << solver.step_convergence[s].max_residual << "\t";
+		output_file << solver.step_convergence[s].not_converged << "\t";
+	}
+}
+
 /// @brief 
 /// Output
 /// This routine prints the output.txt file, that is the file with all the SCIANTIX code calculations.
@@ -39,13 +60,13 @@ inline bool if_exist(const std::string& name)
 /// This function contains different formatting options to print the output.txt file, according to iOutput value.
 void Output()
 {
-	std::string output_name = "output.txt";
+	std::string output_name = Simulation_directory + "output.txt";
 	std::fstream output_file;
 	output_file.open(output_name, std::fstream::in | std::fstream::out | std::fstream::app);
 
 	/// @brief
 	/// iOutput == 1 --> output.txt organized in columns (header + values).
-	if (int(input_variable[iv["iOutput"]].getValue()) == 1)
+	if (option_dispatch.output_format == 1)
 	{
 		if (history_variable[hv["Time step number"]].getFinalValue() == 0)
 		{
@@ -59,6 +80,7 @@ void Output()
 				if (sciantix_variable[i].getOutput())
 					output_file << sciantix_variable[i].getName() << " " << sciantix_variable[i].getUOM() << "\t";
 			}
+			if (Solver_output) SolverOutputHeader(output_file);
 			output_file << "\n";
 		}
 
@@ -75,6 +97,7 @@ void Output()
 				if (sciantix_variable[i].getOutput())
 					output_file << std::setprecision(7) << sciantix_variable[i].getFinalValue() << "\t";
 			}
+			if (Solver_output) SolverOutputValues(output_file);
 			output_file << "\n";
 		}
 	}
@@ -83,7 +106,7 @@ void Output()
 	 * @brief iOutput = 2 prints the complete output.exe file
 	 * 
 	 */
-	else if ((int)input_variable[iv["iOutput"]].getValue() == 2)
+	else if (option_dispatch.output_format == 2)
 	{
 		if (history_variable[hv["Time step number"]].getFinalValue() == 0)
 		{
@@ -97,6 +120,7 @@ void Output()
 				// if (sciantix_variable[i].getOutput())
 					output_file << sciantix_variable[i].getName() << " " << sciantix_variable[i].getUOM() << "\t";
 			}
+			if (Solver_output) SolverOutputHeader(output_file);
 			output_file << "\n";
 		}
 
@@ -113,6 +137,7 @@ void Output()
 				// if (sciantix_variable[i].getOutput())
 					output_file << std::setprecision(7) << sciantix_variable[i].getFinalValue() << "\t";
 			}
+			if (Solver_output) SolverOutputValues(output_file);
 			output_file << "\n";
 		}
 	}
@@ -126,7 +151,7 @@ void Output()
 	 * ### Writing: overview.txt
 	 * 
 	 */
-	std::string overview_name = "overview.txt";
+	std::string overview_name = Simulation_directory + "overview.txt";
 
 	if (history_variable[hv["Time step number"]].getFinalValue() == 0 && if_exist(overview_name))
 		remove(overview_name.c_str()); // from string to const char*
@@ -175,6 +200,16 @@ void Output()
 
 		overview_file << "\n";
 
+		for (std::vector<RegisteredModel>::size_type i = 0; i != model_schedule.size(); ++i)
+		{
+			overview_file << "Scheduled model #" << i << ": " << "\t";
+			overview_file << model_schedule[i].name << "\n";
+		}
+
+		overview_file << "Model sequence: " << (model_specialisation[0] ? model_specialisation : "generic") << "\n";
+
+		overview_file << "\n";
+
 		// for (std::vector<SciantixVariable>::size_type i = 0; i != sciantix_variable.size(); ++i)
 		// {
 		// 	overview_file << "Sciantix variable #" << i << ": " << "\t";
@@ -0,0 +1,261 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "PerformanceCounters.h"
+#include "Stage.h"
+#include <cstring>
+
+#ifdef __linux__
+#include <cerrno>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+thread_local bool performance_counters_enabled(false);
+
+const int n_performance_counters = 4;
+
+static const char* performance_counter_name[n_performance_counters] = { "Cycles", "Instructions", "Cache misses", "Branch misses" };
+
+/// Position of each counter in the values read from the counter group (-1 if the counter is not available)
+static thread_local int performance_counter_position[n_performance_counters] = { -1, -1, -1, -1 };
+static thread_local int performance_counter_fd[n_performance_counters] = { -1, -1, -1, -1 };
+static thread_local int performance_counter_group_fd(-1);
+static thread_local int performance_counter_group_size(0);
+
+// The records and the stack of the open stages are kept in fixed-size arrays, to leave the sampled stages unperturbed
+const int performance_counters_stages_max = 128;
+const int performance_counters_stack_max = 64;
+
+struct PerformanceCountersRecord
+{
+	unsigned long int calls;
+	unsigned long long int counts[n_performance_counters];
+};
+
+struct PerformanceCountersSample
+{
+	bool valid;
+	unsigned long long int time_enabled;
+	unsigned long long int time_running;
+	unsigned long long int counts[n_performance_counters];
+};
+
+static thread_local const char* performance_counters_stage_name[performance_counters_stages_max];
+static thread_local PerformanceCountersRecord performance_counters_records[performance_counters_stages_max];
+static thread_local int performance_counters_stages(0);
+
+static thread_local PerformanceCountersSample performance_counters_stack[performance_counters_stack_max];
+static thread_local int performance_counters_stack_depth(0);
+
+static thread_local unsigned long int performance_counters_failed_reads(0);
+
+static int PerformanceCountersStageIndex(const char* stage_name)
+{
+	/// The stage names are string literals, so they are compared by address first.
+	for (int i = 0; i < performance_counters_stages; ++i)
+	{
+		if (performance_counters_stage_name[i] == stage_name || strcmp(performance_counters_stage_name[i], stage_name) == 0)
+			return i;
+	}
+
+	if (performance_counters_stages == performance_counters_stages_max) return -1;
+
+	performance_counters_stage_name[performance_counters_stages] = stage_name;
+	performance_counters_records[performance_counters_stages] = PerformanceCountersRecord();
+	return performance_counters_stages++;
+}
+
+static void PerformanceCountersRead(PerformanceCountersSample& sample)
+{
+	/// Reads the whole counter group with a single system call.
+	/// Layout (PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING):
+	/// number of counters, time enabled, time running, counter values.
+	sample.valid = false;
+
+#ifdef __linux__
+	unsigned long long int buffer[3 + n_performance_counters];
+	ssize_t size = read(performance_counter_group_fd, buffer, sizeof(buffer));
+	if (size < (ssize_t)((3 + performance_counter_group_size) * sizeof(unsigned long long int))) return;
+
+	sample.time_enabled = buffer[1];
+	sample.time_running = buffer[2];
+	for (int i = 0; i < n_performance_counters; ++i)
+		sample.counts[i] = (performance_counter_position[i] >= 0) ? buffer[3 + performance_counter_position[i]] : 0;
+	sample.valid = true;
+#endif
+}
+
+void PerformanceCountersOpen()
+{
+#ifdef __linux__
+	const unsigned long long int config[n_performance_counters] = {
+		PERF_COUNT_HW_CPU_CYCLES,
+		PERF_COUNT_HW_INSTRUCTIONS,
+		PERF_COUNT_HW_CACHE_MISSES,
+		PERF_COUNT_HW_BRANCH_MISSES
+	};
+
+	for (int i = 0; i < n_performance_counters; ++i)
+	{
+		struct perf_event_attr attribute;
+		memset(&attribute, 0, sizeof(attribute));
+		attribute.type = PERF_TYPE_HARDWARE;
+		attribute.size = sizeof(attribute);
+		attribute.config = config[i];
+		attribute.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+		attribute.disabled = (performance_counter_group_fd == -1);
+		attribute.exclude_kernel = 1;
+		attribute.exclude_hv = 1;
+
+		// The first counter opened is the group leader, the others are read together with it
+		int fd = syscall(__NR_perf_event_open, &attribute, 0, -1, performance_counter_group_fd, 0);
+		if (fd == -1) continue;
+
+		if (performance_counter_group_fd == -1) performance_counter_group_fd = fd;
+		performance_counter_fd[i] = fd;
+		performance_counter_position[i] = performance_counter_group_size++;
+	}
+
+	if (performance_counter_group_fd == -1)
+	{
+		std::cout << "WARNING - PerformanceCounters: perf_event_open failed (" << strerror(errno) << "), the hardware performance counters are not available." << std::endl;
+		return;
+	}
+
+	for (int i = 0; i < n_performance_counters; ++i)
+	{
+		if (performance_counter_position[i] == -1)
+			std::cout << "WARNING - PerformanceCounters: the counter " << performance_counter_name[i] << " is not available." << std::endl;
+	}
+
+	ioctl(performance_counter_group_fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+	ioctl(performance_counter_group_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+
+	performance_counters_enabled = true;
+	StageInstrumentationUpdate();
+#else
+	std::cout << "WARNING - PerformanceCounters: the hardware performance counters are available only on Linux." << std::endl;
+#endif
+}
+
+void PerformanceCountersBegin()
+{
+	if (!performance_counters_enabled) return;
+
+	if (performance_counters_stack_depth < performance_counters_stack_max)
+		PerformanceCountersRead(performance_counters_stack[performance_counters_stack_depth]);
+
+	performance_counters_stack_depth++;
+}
+
+void PerformanceCountersEnd(const char* stage_name)
+{
+	if (!performance_counters_enabled || performance_counters_stack_depth == 0) return;
+
+	performance_counters_stack_depth--;
+	if (performance_counters_stack_depth >= performance_counters_stack_max) return;
+
+	const PerformanceCountersSample& begin = performance_counters_stack[performance_counters_stack_depth];
+	PerformanceCountersSample end;
+	PerformanceCountersRead(end);
+
+	// A stage with a failed read (at its beginning or at its end) is not recorded
+	if (!begin.valid || !end.valid || end.time_running < begin.time_running || end.time_enabled < begin.time_enabled)
+	{
+		performance_counters_failed_reads++;
+		return;
+	}
+
+	const int stage = PerformanceCountersStageIndex(stage_name);
+	if (stage == -1) return;
+
+	// When the counters are multiplexed with other events, they run only for a fraction of the stage:
+	// the counts are scaled by the ratio between the time enabled and the time running in the stage
+	const unsigned long long int time_enabled = end.time_enabled - begin.time_enabled;
+	const unsigned long long int time_running = end.time_running - begin.time_running;
+	const double scaling = (time_running > 0 && time_running < time_enabled) ? (double)time_enabled / time_running : 1.0;
+
+	PerformanceCountersRecord& record = performance_counters_records[stage];
+	record.calls++;
+	for (int i = 0; i < n_performance_counters; ++i)
+	{
+		if (end.counts[i] >= begin.counts[i])
+			record.counts[i] += (unsigned long long int)((end.counts[i] - begin.counts[i]) * scaling);
+	}
+}
+
+void PerformanceCountersClose(std::string file_name)
+{
+	if (!performance_counters_enabled) return;
+
+#ifdef __linux__
+	unsigned long long int buffer[3 + n_performance_counters];
+	if (read(performance_counter_group_fd, buffer, sizeof(buffer)) > 0 && buffer[2] < buffer[1])
+		std::cout << "WARNING - PerformanceCounters: the counters have been multiplexed with other events, the counts are scaled estimates." << std::endl;
+
+	if (performance_counters_failed_reads > 0)
+		std::cout << "WARNING - PerformanceCounters: " << performance_counters_failed_reads << " stage samples have been discarded (failed counter reads)." << std::endl;
+
+	for (int i = 0; i < n_performance_counters; ++i)
+	{
+		if (performance_counter_fd[i] != -1) close(performance_counter_fd[i]);
+		performance_counter_fd[i] = -1;
+	}
+	performance_counter_group_fd = -1;
+#endif
+
+	performance_counters_enabled = false;
+	StageInstrumentationUpdate();
+
+	std::ofstream performance_counters_file;
+	performance_counters_file.open(file_name, std::ios::out);
+
+	performance_counters_file << "Stage\tCalls\t";
+	for (int i = 0; i < n_performance_counters; ++i)
+		performance_counters_file << performance_counter_name[i] << "\t";
+	performance_counters_file << "Instructions per cycle\t" << std::endl;
+
+	for (int s = 0; s < performance_counters_stages; ++s)
+	{
+		const PerformanceCountersRecord& record = performance_counters_records[s];
+
+		performance_counters_file << performance_counters_stage_name[s] << "\t" << record.calls << "\t";
+		for (int i = 0; i < n_performance_counters; ++i)
+		{
+			if (performance_counter_position[i] >= 0)
+				performance_counters_file << record.counts[i] << "\t";
+			else
+				performance_counters_file << "n/a\t";
+		}
+
+		if (performance_counter_position[0] >= 0 && performance_counter_position[1] >= 0 && record.counts[0] > 0)
+			performance_counters_file << std::fixed << std::setprecision(3) << (double)record.counts[1] / record.counts[0] << "\t" << std::endl;
+		else
+			performance_counters_file << "n/a\t" << std::endl;
+	}
+
+	performance_counters_file.close();
+
+	performance_counters_stages = 0;
+	performance_counters_stack_depth = 0;
+	performance_counters_failed_reads = 0;
+	for (int i = 0; i < n_performance_counters; ++i)
+		performance_counter_position[i] = -1;
+	performance_counter_group_size = 0;
+}
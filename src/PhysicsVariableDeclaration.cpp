@@ -18,5 +18,5 @@
 
 /// PhysicsVariableDeclaration.h
 
-std::vector<PhysicsVariable> physics_variable;
+thread_local std::vector<PhysicsVariable> physics_variable;
 
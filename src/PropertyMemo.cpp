@@ -0,0 +1,63 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "PropertyMemo.h"
+
+// Correlations memoised in the thread, in order of first evaluation
+static thread_local std::vector<PropertyMemoCounter*> property_memo_counters;
+
+PropertyMemoCounter::PropertyMemoCounter(const char* n) : name(n), hits(0), misses(0)
+{
+	property_memo_counters.push_back(this);
+}
+
+void PropertyMemoReset()
+{
+	// The stored values stay valid, being identified by their inputs
+	for (std::vector<PropertyMemoCounter*>::size_type i = 0; i != property_memo_counters.size(); ++i)
+	{
+		property_memo_counters[i]->hits = 0;
+		property_memo_counters[i]->misses = 0;
+	}
+}
+
+void PropertyMemoReport(std::string file_name)
+{
+	std::ofstream report_file;
+	report_file.open(file_name, std::ios::out);
+
+	unsigned long int hits(0), misses(0);
+
+	report_file << "Correlation\tEvaluations\tHits\tMisses\tHit rate (%)\t" << std::endl;
+	for (std::vector<PropertyMemoCounter*>::size_type i = 0; i != property_memo_counters.size(); ++i)
+	{
+		const PropertyMemoCounter& counter = *property_memo_counters[i];
+		const unsigned long int evaluations = counter.hits + counter.misses;
+		if (evaluations == 0) continue;
+
+		report_file << counter.name << "\t" << evaluations << "\t" << counter.hits << "\t" << counter.misses << "\t"
+			<< std::fixed << std::setprecision(1) << 100.0 * counter.hits / evaluations << "\t" << std::endl;
+
+		hits += counter.hits;
+		misses += counter.misses;
+	}
+
+	if (hits + misses)
+		report_file << "Total\t" << hits + misses << "\t" << hits << "\t" << misses << "\t"
+			<< std::fixed << std::setprecision(1) << 100.0 * hits / (hits + misses) << "\t" << std::endl;
+
+	report_file.close();
+}
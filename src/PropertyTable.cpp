@@ -0,0 +1,102 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "PropertyTable.h"
+
+// Range of temperature (K) covered by the tables
+static const double table_temperature_min = 200.0;
+static const double table_temperature_max = 5000.0;
+
+// Beyond this number of intervals the correlation is not tabulated (i.e., the tolerance is too close to the round-off)
+static const int table_intervals_max = 1 << 20;
+
+// Tables defined in the program, in order of construction
+static std::vector<PropertyTable*>& PropertyTableRegistry()
+{
+	static std::vector<PropertyTable*> registry;
+	return registry;
+}
+
+PropertyTable::PropertyTable(const char* n, Correlation c) :
+	name(n), correlation(c), intervals(0), max_relative_error(0.0), inverse_temperature_min(0.0), inverse_step(0.0)
+{
+	PropertyTableRegistry().push_back(this);
+}
+
+bool PropertyTable::Build(double tolerance)
+{
+	const double inverse_temperature_max = 1.0 / table_temperature_min;
+	inverse_temperature_min = 1.0 / table_temperature_max;
+
+	for (intervals = 64; intervals <= table_intervals_max; intervals *= 2)
+	{
+		const double step = (inverse_temperature_max - inverse_temperature_min) / intervals;
+		inverse_step = 1.0 / step;
+
+		value.resize(intervals + 3);
+		for (int k = 0; k < intervals + 3; ++k)
+			value[k] = correlation(1.0 / (inverse_temperature_min + (k - 1) * step));
+
+		max_relative_error = 0.0;
+		for (int i = 0; i < intervals; ++i)
+		{
+			for (int j = 1; j < 4; ++j)
+			{
+				const double temperature = 1.0 / (inverse_temperature_min + (i + 0.25 * j) * step);
+				const double exact = correlation(temperature);
+				const double relative_error = std::abs((*this)(temperature) - exact) / exact;
+
+				if (relative_error > max_relative_error) max_relative_error = relative_error;
+			}
+		}
+
+		if (max_relative_error <= tolerance) return true;
+	}
+
+	value.clear();
+	intervals = 0;
+	return false;
+}
+
+void PropertyTables(double tolerance)
+{
+	/**
+	 * @brief Builds all the property tables with the given relative tolerance, and writes property_tables.txt
+	 * in the simulation directory with the intervals and the largest relative error of each table.
+	 * The correlations for which the tolerance cannot be achieved are evaluated.
+	 * 
+	 */
+
+	std::ofstream table_file;
+	table_file.open(Simulation_directory + "property_tables.txt", std::ios::out);
+
+	table_file << "Tolerance = " << std::scientific << std::setprecision(3) << tolerance << ", "
+		<< std::fixed << std::setprecision(0) << table_temperature_min << " K < T < " << table_temperature_max << " K" << std::endl;
+	table_file << "Correlation\tIntervals\tMax relative error\t" << std::endl;
+
+	std::vector<PropertyTable*>& registry = PropertyTableRegistry();
+	for (std::vector<PropertyTable*>::size_type i = 0; i != registry.size(); ++i)
+	{
+		PropertyTable& table = *registry[i];
+
+		if (table.Build(tolerance))
+			table_file << table.name << "\t" << table.intervals << "\t" << std::scientific << std::setprecision(3) << table.max_relative_error << "\t" << std::endl;
+		else
+			table_file << table.name << "\t" << "not tabulated" << "\t" << "\t" << std::endl;
+	}
+
+	table_file.close();
+}
@@ -0,0 +1,49 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+/// RunSimulation
+/// This routine runs a complete SCIANTIX simulation in the working directory:
+/// it reads the input files, integrates the input history time step by time step, and writes the output files.
+/// Every call starts from the state defined by the input files, so that several simulations can be run in the same process
+/// (e.g., by the benchmark of the regression database).
+
+#include "RunSimulation.h"
+
+void RunSimulation()
+{
+	// Reads the input files and sets the initial state (or the state of the checkpoint to resume)
+	SimulationStepper simulation;
+
+	Execution_file.open(Simulation_directory + "execution.txt", std::ios::out);
+
+	if (Trace_output) TraceOpen("trace.json");
+	if (Performance_counters_output) PerformanceCountersOpen();
+	AllocationCountingOpen("allocations.txt");
+
+	timer = clock();
+
+	while (simulation.step());
+
+	timer = clock() - timer;
+
+	TraceClose();
+	PerformanceCountersClose("performance_counters.txt");
+	AllocationCountingClose("allocations_summary.txt");
+	simulation.finish();
+
+	Execution_file << std::setprecision(12) << std::scientific << (double)timer / CLOCKS_PER_SEC << "\t" << CLOCKS_PER_SEC << "\t" << (double)timer << "\t" << Time_step_number << std::endl;
+	Execution_file.close();
+}
@@ -0,0 +1,106 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "ScheduleCheck.h"
+
+#ifdef SCIANTIX_SCHEDULE_CHECK
+
+#include "ModelRegistry.h"
+#include "SciantixDiffusionModeDeclaration.h"
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+
+const int schedule_check_slots = 300;
+const int schedule_check_modes = 1000;
+
+static thread_local bool schedule_check_active(false);
+static thread_local bool schedule_check_read[schedule_check_slots];
+static thread_local bool schedule_check_write[schedule_check_slots];
+static thread_local double schedule_check_modes_before[schedule_check_modes];
+
+static bool NameMatch(const char* pattern, const char* name)
+{
+	/// Match of a declared name with a variable name, '*' standing for any sequence of characters (e.g., "* in grain").
+	if (*pattern == '\0') return *name == '\0';
+	if (*pattern == '*') return NameMatch(pattern + 1, name) || (*name != '\0' && NameMatch(pattern, name + 1));
+	return *pattern == *name && NameMatch(pattern + 1, name + 1);
+}
+
+static bool Declared(const std::vector<std::string>& declaration, const std::string& name)
+{
+	for (std::vector<std::string>::size_type i = 0; i != declaration.size(); ++i)
+	{
+		if (NameMatch(declaration[i].c_str(), name.c_str()))
+			return true;
+	}
+	return false;
+}
+
+void ScheduleCheckAccess(int slot, bool write)
+{
+	if (!schedule_check_active || slot < 0 || slot >= schedule_check_slots) return;
+
+	if (write)
+		schedule_check_write[slot] = true;
+	else
+		schedule_check_read[slot] = true;
+}
+
+void ScheduleCheckBegin()
+{
+	for (int i = 0; i < schedule_check_slots; ++i)
+	{
+		schedule_check_read[i] = false;
+		schedule_check_write[i] = false;
+	}
+	std::memcpy(schedule_check_modes_before, modes_initial_conditions, sizeof(schedule_check_modes_before));
+	schedule_check_active = true;
+}
+
+void ScheduleCheckModel(const RegisteredModel& registered_model)
+{
+	schedule_check_active = false;
+
+	bool declared(true);
+	for (std::vector<SciantixVariable>::size_type i = 0; i != sciantix_variable.size(); ++i)
+	{
+		const int slot = sciantix_variable[i].getSlot();
+		const std::string name = sciantix_variable[i].getName();
+
+		if (schedule_check_write[slot] && !Declared(registered_model.writes, name))
+		{
+			std::cerr << "ERROR - ScheduleCheck: " << registered_model.name << " writes " << name << ", not declared among its writes." << std::endl;
+			declared = false;
+		}
+		else if (schedule_check_read[slot] && !Declared(registered_model.reads, name) && !Declared(registered_model.writes, name))
+		{
+			std::cerr << "ERROR - ScheduleCheck: " << registered_model.name << " reads " << name << ", not declared among its reads." << std::endl;
+			declared = false;
+		}
+	}
+
+	// The diffusion modes are not accessed through the variables, they are compared with their values before the model
+	if (std::memcmp(schedule_check_modes_before, modes_initial_conditions, sizeof(schedule_check_modes_before)) != 0 && !Declared(registered_model.writes, "Diffusion modes"))
+	{
+		std::cerr << "ERROR - ScheduleCheck: " << registered_model.name << " writes the diffusion modes, not declared among its writes." << std::endl;
+		declared = false;
+	}
+
+	if (!declared) exit(1);
+}
+
+#endif
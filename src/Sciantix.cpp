@@ -22,83 +22,67 @@ void Sciantix(int Sciantix_options[],
 	double Sciantix_scaling_factors[],
 	double Sciantix_diffusion_modes[])
 {
-	SetVariables(Sciantix_options, Sciantix_history, Sciantix_variables, Sciantix_scaling_factors, Sciantix_diffusion_modes);
-
-	SetGas();
-
-	SetMatrix();
-
-	SetSystem();
-
-	Simulation sciantix_simulation;
-
-	Burnup();
-	MapModel();
-	sciantix_simulation.Burnup();
-
-	EffectiveBurnup();
-	MapModel();
-	sciantix_simulation.EffectiveBurnup();
-
-	EnvironmentComposition();
-	MapModel();
-
-	UO2Thermochemistry();
-	MapModel();
-	sciantix_simulation.UO2Thermochemistry();
-
-	StoichiometryDeviation();
-	MapModel();
-	sciantix_simulation.StoichiometryDeviation(); 
-
-	HighBurnupStructureFormation();
-	MapModel();
-	sciantix_simulation.HighBurnupStructureFormation();
+	Sciantix(Sciantix_options, Sciantix_history, Sciantix_variables, Sciantix_variables, Sciantix_scaling_factors, Sciantix_diffusion_modes, Sciantix_diffusion_modes);
+}
 
-	HighBurnupStructurePorosity();
-	MapModel();
-	sciantix_simulation.HighBurnupStructurePorosity();
+void Sciantix(int Sciantix_options[],
+	double Sciantix_history[],
+	const double Sciantix_variables_start[],
+	double Sciantix_variables[],
+	double Sciantix_scaling_factors[],
+	const double Sciantix_diffusion_modes_start[],
+	double Sciantix_diffusion_modes[])
+{
+	// The input settings are defined and resolved (OptionDispatching) once per simulation, and so are the models to run (ModelScheduling)
+	// and their sequence, specialised for the input settings where available (ModelSpecialisation)
+	bool new_simulation = input_variable.empty();
 
-	GrainGrowth();
-	MapModel();
-	sciantix_simulation.GrainGrowth();
+	StageBegin("SetVariables");
+	SetVariables(Sciantix_options, Sciantix_history, Sciantix_variables_start, Sciantix_variables, Sciantix_scaling_factors, Sciantix_diffusion_modes_start, Sciantix_diffusion_modes);
+	StageEnd("SetVariables");
 
-	GrainBoundarySweeping();
-	MapModel();
-	sciantix_simulation.GrainBoundarySweeping();
+	if (new_simulation)
+	{
+		ModelScheduling();
+		ModelSpecialisation();
+	}
 
-	GasProduction();
-	MapModel();
-	sciantix_simulation.GasProduction();
+	StageBegin("SetGas");
+	SetGas();
+	StageEnd("SetGas");
 
-	sciantix_simulation.GasDecay();
+	StageBegin("SetMatrix");
+	option_dispatch.set_matrix();
+	StageEnd("SetMatrix");
 
-	IntraGranularBubbleEvolution();
-	MapModel();
-	sciantix_simulation.IntraGranularBubbleBehaviour();
+	StageBegin("SetSystem");
+	option_dispatch.set_system();
+	StageEnd("SetSystem");
 
-	GasDiffusion();
-	MapModel();
-	sciantix_simulation.GasDiffusion();
+	Simulation sciantix_simulation;
 
-	GrainBoundaryMicroCracking();
-	MapModel();
-	sciantix_simulation.GrainBoundaryMicroCracking();
+	model_sequence(sciantix_simulation);
 
-	GrainBoundaryVenting();
-	MapModel();
-	sciantix_simulation.GrainBoundaryVenting();
+	StageBegin("FiguresOfMerit");
+	FiguresOfMerit();
+	StageEnd("FiguresOfMerit");
 
-	InterGranularBubbleEvolution();
-	MapModel();
-	sciantix_simulation.InterGranularBubbleBehaviour();
+	sciantix_variable_store.unbind();
 
-	FiguresOfMerit();
-	
-	UpdateVariables(Sciantix_variables, Sciantix_diffusion_modes);
+	if (Output_txt)
+	{
+		StageBegin("Output");
+		Output();
+		StageEnd("Output");
+	}
 
-	Output();
+	StageBegin("Clear");
+	SciantixClear();
+	StageEnd("Clear");
+}
 
+void SciantixClear()
+{
 	history_variable.clear();
 	sciantix_variable.clear();
 	sciantix_system.clear();
@@ -19,4 +19,8 @@
 /// SciantixDiffusionModeDeclaration
 
 const int n_modes(40);
-double modes_initial_conditions[n_modes * n_modes];
\ No newline at end of file
+// Bound to the Sciantix_diffusion_modes array of the caller during Sciantix() (SetVariables)
+thread_local double* modes_initial_conditions(0);
+// Start-of-step modes, when different from modes_initial_conditions, and blocks already copied from them (DiffusionModes)
+thread_local const double* modes_start(0);
+thread_local unsigned int modes_copied(0);
\ No newline at end of file
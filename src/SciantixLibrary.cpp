@@ -0,0 +1,343 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+/// SciantixLibrary
+/// This routine implements the C interface of libsciantix (SciantixLibrary.h) on top of Sciantix().
+/// The arrays of the Sciantix() interface are held by the context. The input settings are resolved once per simulation
+/// in each thread (OptionDispatching, ModelScheduling): they are resolved again when a thread advances a different context,
+/// or a context with different input settings, than the previous one.
+/// The calls into SCIANTIX run with the errors thrown (ErrorMessages::throw_errors) and without output.txt (Output_txt),
+/// in the calling thread only: an error is returned as -1, and the process never exits.
+
+#include "SciantixLibrary.h"
+#include "Sciantix.h"
+#include "Initialization.h"
+#include "ErrorMessages.h"
+#include <new>
+#include <atomic>
+#include <algorithm>
+#include <exception>
+
+struct sciantix_context
+{
+	int options[SCIANTIX_OPTIONS];
+	double history[20];
+	double variables[SCIANTIX_VARIABLES];
+	double scaling_factors[SCIANTIX_SCALING_FACTORS];
+	double diffusion_modes[SCIANTIX_DIFFUSION_MODES];
+
+	long long int time_step_number;
+	double time;
+
+	// Identity of the simulation, changed with the input settings
+	unsigned long long int simulation;
+};
+
+/// Input settings of a new context: the ones of regression/input_settings.txt (the recommended choice for UO2, see utilities/InputExplanation.md)
+static const int library_default_options[SCIANTIX_OPTIONS] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+
+/// Initial conditions of a new context: the ones of the regression cases (e.g., test_Baker1977__1273K), i.e., grain radius (m),
+/// fuel density (kg/m3) and uranium enrichment (% of U-235 and U-238), the other ones are 0
+static const int library_default_initial_conditions = 46;
+static const double library_default_variables[library_default_initial_conditions] =
+{
+	5.0e-06, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+	0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+	0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+	0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+	10641.0, 0.0, 3.0, 0.0, 0.0, 97.0
+};
+
+/// Values accepted for each input setting, in the order of input_settings.txt: first to last, and 99 where marked
+/// (the values resolved by OptionDispatching and the resolvers of the models). The elements not read by SCIANTIX must be 0.
+struct LibraryOptionRange
+{
+	int first;
+	int last;
+	bool accepts_99;
+};
+
+static const LibraryOptionRange library_option_range[] =
+{
+	{ 0, 2, false },	// iGrainGrowth
+	{ 0, 6, true },		// iFGDiffusionCoefficient
+	{ 1, 2, false },	// iDiffusionSolver
+	{ 0, 3, true },		// iIntraGranularBubbleEvolution
+	{ 0, 3, true },		// iResolutionRate
+	{ 0, 1, true },		// iTrappingRate
+	{ 0, 1, true },		// iNucleationRate
+	{ 1, 2, false },	// iOutput
+	{ 0, 2, false },	// iGrainBoundaryVacancyDiffusivity
+	{ 0, 1, false },	// iGrainBoundaryBehaviour
+	{ 0, 1, false },	// iGrainBoundaryMicroCracking
+	{ 0, 1, false },	// iFuelMatrix
+	{ 0, 1, false },	// iGrainBoundaryVenting
+	{ 0, 1, false },	// iRadioactiveFissionGas
+	{ 0, 1, false },	// iHelium
+	{ 0, 3, true },		// iHeDiffusivity
+	{ 0, 1, false },	// iGrainBoundarySweeping
+	{ 0, 1, false },	// iHighBurnupStructureFormation
+	{ 0, 0, false },	// iHBS_FGDiffusionCoefficient
+	{ 0, 1, false },	// iHighBurnupStructurePorosity
+	{ 0, 3, false },	// iHeliumProductionRate
+	{ 0, 6, false },	// iStoichiometryDeviation
+	{ 0, 1, false },	// iBubbleDiffusivity
+};
+
+static const int library_options_read = int(sizeof(library_option_range) / sizeof(library_option_range[0]));
+
+static bool LibraryOptionValid(int index, int value)
+{
+	if (index >= library_options_read) return value == 0;
+
+	const LibraryOptionRange& range = library_option_range[index];
+	return (value >= range.first && value <= range.last) || (range.accepts_99 && value == 99);
+}
+
+/// Settings of the calling thread for a call into SCIANTIX, restored at the end of the call
+class LibraryCall
+{
+protected:
+	bool throw_errors;
+	bool output_txt;
+
+public:
+	LibraryCall() : throw_errors(ErrorMessages::throw_errors), output_txt(Output_txt)
+	{
+		ErrorMessages::throw_errors = true;
+		Output_txt = false;
+	}
+	~LibraryCall()
+	{
+		ErrorMessages::throw_errors = throw_errors;
+		Output_txt = output_txt;
+	}
+};
+
+static std::atomic<unsigned long long int> library_simulations(0);
+
+// Simulation whose input settings are resolved in the calling thread
+static thread_local unsigned long long int library_resolved_simulation(0);
+
+static void LibraryResolve(sciantix_context* context)
+{
+	// As in RunSimulation, the input variables are defined (and the input settings resolved) at the first time step of a simulation
+	if (library_resolved_simulation != context->simulation)
+	{
+		input_variable.clear();
+		library_resolved_simulation = context->simulation;
+	}
+}
+
+static void LibraryInitialConditions(sciantix_context* context, const double* variables, int n_variables)
+{
+	std::fill(context->variables, context->variables + SCIANTIX_VARIABLES, 0.0);
+	std::fill(context->diffusion_modes, context->diffusion_modes + SCIANTIX_DIFFUSION_MODES, 0.0);
+	std::copy(variables, variables + n_variables, context->variables);
+
+	InitialConditions(context->variables, context->diffusion_modes);
+
+	std::fill(context->history, context->history + 20, 0.0);
+	context->time_step_number = 0;
+	context->time = 0.0;
+}
+
+extern "C"
+{
+
+sciantix_context* sciantix_create(void)
+{
+	sciantix_context* context = new (std::nothrow) sciantix_context;
+	if (context == NULL) return NULL;
+
+	std::copy(library_default_options, library_default_options + SCIANTIX_OPTIONS, context->options);
+	std::fill(context->scaling_factors, context->scaling_factors + SCIANTIX_SCALING_FACTORS, 0.0);
+	std::fill(context->scaling_factors, context->scaling_factors + 8, 1.0);
+	context->simulation = ++library_simulations;
+
+	try
+	{
+		LibraryCall call;
+		LibraryInitialConditions(context, library_default_variables, library_default_initial_conditions);
+	}
+	catch (const std::exception&)
+	{
+		delete context;
+		return NULL;
+	}
+
+	return context;
+}
+
+void sciantix_destroy(sciantix_context* context)
+{
+	delete context;
+}
+
+int sciantix_set_options(sciantix_context* context, const int* options, int n_options)
+{
+	if (context == NULL || options == NULL || n_options < 0 || n_options > SCIANTIX_OPTIONS) return -1;
+
+	// The input settings are replaced only if all of them are valid
+	for (int i = 0; i < n_options; ++i)
+		if (!LibraryOptionValid(i, options[i])) return -1;
+
+	std::copy(options, options + n_options, context->options);
+	context->simulation = ++library_simulations;
+
+	return 0;
+}
+
+int sciantix_set_scaling_factors(sciantix_context* context, const double* scaling_factors, int n_scaling_factors)
+{
+	if (context == NULL || scaling_factors == NULL || n_scaling_factors < 0 || n_scaling_factors > SCIANTIX_SCALING_FACTORS) return -1;
+
+	std::copy(scaling_factors, scaling_factors + n_scaling_factors, context->scaling_factors);
+
+	return 0;
+}
+
+int sciantix_set_initial_conditions(sciantix_context* context, const double* variables, int n_variables)
+{
+	if (context == NULL || variables == NULL || n_variables < 0 || n_variables > SCIANTIX_VARIABLES) return -1;
+
+	try
+	{
+		LibraryCall call;
+		LibraryInitialConditions(context, variables, n_variables);
+	}
+	catch (const std::exception&)
+	{
+		return -1;
+	}
+
+	return 0;
+}
+
+int sciantix_set_state(sciantix_context* context, const double* variables, int n_variables, const double* diffusion_modes, int n_diffusion_modes)
+{
+	if (context == NULL || variables == NULL || n_variables < 0 || n_variables > SCIANTIX_VARIABLES) return -1;
+	if (diffusion_modes == NULL || n_diffusion_modes < 0 || n_diffusion_modes > SCIANTIX_DIFFUSION_MODES) return -1;
+
+	std::copy(variables, variables + n_variables, context->variables);
+	std::copy(diffusion_modes, diffusion_modes + n_diffusion_modes, context->diffusion_modes);
+
+	return 0;
+}
+
+int sciantix_get_state(const sciantix_context* context, double* variables, int n_variables, double* diffusion_modes, int n_diffusion_modes)
+{
+	if (context == NULL || variables == NULL || n_variables < 0 || n_variables > SCIANTIX_VARIABLES) return -1;
+	if (diffusion_modes == NULL || n_diffusion_modes < 0 || n_diffusion_modes > SCIANTIX_DIFFUSION_MODES) return -1;
+
+	std::copy(context->variables, context->variables + n_variables, variables);
+	std::copy(context->diffusion_modes, context->diffusion_modes + n_diffusion_modes, diffusion_modes);
+
+	return 0;
+}
+
+int sciantix_advance(sciantix_context* context, double time_step, double temperature, double fission_rate, double hydrostatic_stress, double steam_pressure)
+{
+	if (context == NULL || !(time_step >= 0.0)) return -1;
+
+	// Sciantix_history, as interpolated from the input history (SimulationTimeStep), kept by the context only if the time step succeeds
+	double history[20];
+	std::copy(context->history, context->history + 20, history);
+	const bool first_time_step = (context->time_step_number == 0);
+	history[0] = first_time_step ? temperature : history[1];
+	history[1] = temperature;
+	history[2] = first_time_step ? fission_rate : history[3];
+	history[3] = fission_rate;
+	history[4] = first_time_step ? hydrostatic_stress : history[5];
+	history[5] = hydrostatic_stress;
+	history[6] = time_step;
+	history[7] = (context->time + time_step) / 3600.0;
+	history[8] = static_cast<double>(context->time_step_number);
+	history[9] = first_time_step ? steam_pressure : history[10];
+	history[10] = steam_pressure;
+
+	try
+	{
+		LibraryCall call;
+		LibraryResolve(context);
+		Sciantix(context->options, history, context->variables, context->scaling_factors, context->diffusion_modes);
+	}
+	catch (const std::exception&)
+	{
+		// The objects of the interrupted time step are cleared, and the next call resolves the input settings again
+		SciantixClear();
+		library_resolved_simulation = 0;
+		return -1;
+	}
+
+	std::copy(history, history + 20, context->history);
+	context->time += time_step;
+	++context->time_step_number;
+
+	return 0;
+}
+
+int sciantix_variable_handle(sciantix_context* context, const char* name)
+{
+	if (context == NULL || name == NULL) return -1;
+
+	// The sciantix variables are defined (SetVariables) on copies of the state, to read the slot of the variable
+	double history[20], variables[SCIANTIX_VARIABLES], diffusion_modes[SCIANTIX_DIFFUSION_MODES];
+	std::copy(context->history, context->history + 20, history);
+	std::copy(context->variables, context->variables + SCIANTIX_VARIABLES, variables);
+	std::copy(context->diffusion_modes, context->diffusion_modes + SCIANTIX_DIFFUSION_MODES, diffusion_modes);
+
+	int handle(-1);
+	try
+	{
+		LibraryCall call;
+		LibraryResolve(context);
+		SetVariables(context->options, history, variables, variables, context->scaling_factors, diffusion_modes, diffusion_modes);
+
+		for (std::vector<SciantixVariable>::size_type i = 0; i != sciantix_variable.size(); ++i)
+			if (sciantix_variable[i].getName() == name)
+				handle = sciantix_variable[i].getSlot();
+	}
+	catch (const std::exception&)
+	{
+		handle = -1;
+	}
+
+	// The next time step resolves the input settings again, as the first one of a simulation
+	SciantixClear();
+	library_resolved_simulation = 0;
+
+	return handle;
+}
+
+double sciantix_get_variable(const sciantix_context* context, int handle)
+{
+	if (context == NULL || handle < 0 || handle >= SCIANTIX_VARIABLES) return 0.0;
+
+	return context->variables[handle];
+}
+
+double sciantix_get_time(const sciantix_context* context)
+{
+	return (context == NULL) ? 0.0 : context->time;
+}
+
+long long int sciantix_get_time_step_number(const sciantix_context* context)
+{
+	return (context == NULL) ? 0 : context->time_step_number;
+}
+
+}
@@ -18,13 +18,13 @@
 
 /// SciantixScalingFactorDeclaration
 
-double sf_resolution_rate(1.0);
-double sf_trapping_rate(1.0);
-double sf_nucleation_rate(1.0);
-double sf_diffusivity(1.0);
-double sf_screw_parameter(1.0);
-double sf_span_parameter(1.0);
-double sf_cent_parameter(1.0);
-double sf_helium_production_rate(1.0);
-double sf_temperature(1.0);
-double sf_fission_rate(1.0);
\ No newline at end of file
+thread_local double sf_resolution_rate(1.0);
+thread_local double sf_trapping_rate(1.0);
+thread_local double sf_nucleation_rate(1.0);
+thread_local double sf_diffusivity(1.0);
+thread_local double sf_screw_parameter(1.0);
+thread_local double sf_span_parameter(1.0);
+thread_local double sf_cent_parameter(1.0);
+thread_local double sf_helium_production_rate(1.0);
+thread_local double sf_temperature(1.0);
+thread_local double sf_fission_rate(1.0);
\ No newline at end of file
@@ -18,6 +18,7 @@
 
 /// SciantixVariableDeclaration.h
 
-std::vector<SciantixVariable> sciantix_variable;
+thread_local std::vector<SciantixVariable> sciantix_variable;
+thread_local VariableStore sciantix_variable_store;
 
 
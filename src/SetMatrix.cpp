@@ -16,6 +16,27 @@
 
 #include "SetMatrix.h"
 
+/// Temperature factors of the Arrhenius correlations, tabulated with --property-tables (PropertyTable)
+
+static double AinscoughMobility(double temperature) { return exp(- 32114.5 / temperature); }
+static double VanUffelenMobility(double temperature) { return exp(- 46524.0 / temperature); }
+
+static double ReynoldsBurtonVacancyDiffusion(double temperature)
+{
+	return exp(- 5.35e-19 / (CONSTANT_NUMBERS_H::PhysicsConstants::boltzmann_constant * temperature));
+}
+
+static double PastoreVacancyDiffusion(double temperature)
+{
+	return exp(- 5.75e-19 / (CONSTANT_NUMBERS_H::PhysicsConstants::boltzmann_constant * temperature));
+}
+
+static PropertyTable ainscough_mobility("Grain-boundary mobility, exp(-32114.5 K / T)", AinscoughMobility);
+static PropertyTable van_uffelen_mobility("Grain-boundary mobility, exp(-46524 K / T)", VanUffelenMobility);
+static PropertyTable reynolds_burton_vacancy_diffusion("Grain-boundary vacancy diffusivity, exp(-5.35e-19 J / kT)", ReynoldsBurtonVacancyDiffusion);
+static PropertyTable pastore_vacancy_diffusion("Grain-boundary vacancy diffusivity, exp(-5.75e-19 J / kT)", PastoreVacancyDiffusion);
+
+template <int iFuelMatrix>
 void SetMatrix( )
 {
   /**
@@ -23,7 +44,7 @@ void SetMatrix( )
    * 
    */
 
-	switch (int(input_variable[iv["iFuelMatrix"]].getValue()))
+	switch (iFuelMatrix)
 	{
 		case 0: 
 		{
@@ -43,16 +64,24 @@ void SetMatrix( )
 
 			break;
 		}
-		
-		default:
-			ErrorMessages::Switch("SetMatrix.cpp", "iFuelMatrix", int(input_variable[iv["iFuelMatrix"]].getValue()));
-			break;
 	}
+}
 
+MatrixDefinition SetMatrixDefinition(int iFuelMatrix)
+{
+	switch (iFuelMatrix)
+	{
+		case 0: return &SetMatrix<0>;
+		case 1: return &SetMatrix<1>;
 
+		default:
+			ErrorMessages::Switch("SetMatrix.cpp", "iFuelMatrix", iFuelMatrix);
+			return nullptr;
+	}
 }
 
-void Matrix::setGrainBoundaryMobility(int input_value)
+template <int input_value>
+void Matrix::setGrainBoundaryMobility()
 {
 	switch (input_value)
 	{
@@ -76,7 +105,13 @@ void Matrix::setGrainBoundaryMobility(int input_value)
 		 * 
 		*/
 		reference += "Ainscough et al., JNM, 49 (1973) 117-128.\n\t";
-		grain_boundary_mobility = 1.455e-8 * exp(- 32114.5 / history_variable[hv["Temperature"]].getFinalValue());
+
+		static thread_local PropertyMemo<1> memo("Grain-boundary mobility, iGrainGrowth = 1");
+		const double inputs[] = { history_variable[hv["Temperature"]].getFinalValue() };
+		if (memo.Find(inputs, grain_boundary_mobility)) break;
+
+		grain_boundary_mobility = 1.455e-8 * ainscough_mobility(inputs[0]);
+		memo.Store(inputs, grain_boundary_mobility);
 		break;
 	}
 
@@ -88,25 +123,26 @@ void Matrix::setGrainBoundaryMobility(int input_value)
 		*/
 
 		reference += "Van Uffelen et al. JNM, 434 (2013) 287–29.\n\t";
-		grain_boundary_mobility = 1.360546875e-15 * exp(- 46524.0 / history_variable[hv["Temperature"]].getFinalValue());
-		break;
-	}
 
-	default:
-		ErrorMessages::Switch("SetMatrix.cpp", "iGrainGrowth", input_value);
+		static thread_local PropertyMemo<1> memo("Grain-boundary mobility, iGrainGrowth = 2");
+		const double inputs[] = { history_variable[hv["Temperature"]].getFinalValue() };
+		if (memo.Find(inputs, grain_boundary_mobility)) break;
+
+		grain_boundary_mobility = 1.360546875e-15 * van_uffelen_mobility(inputs[0]);
+		memo.Store(inputs, grain_boundary_mobility);
 		break;
 	}
+	}
 }
 
-void Matrix::setGrainBoundaryVacancyDiffusivity(int input_value)
+template <int input_value>
+void Matrix::setGrainBoundaryVacancyDiffusivity()
 {
 	/** 
 	 * ### GrainBoundaryVacancyDiffusivity
 	 * @brief The diffusivity of the vacancies on the grain-boundaries is set according to the input_variable iGrainBoundaryVacancyDiffusivity.
 	 * 
 	 */
-	
-	const double boltzmann_constant = CONSTANT_NUMBERS_H::PhysicsConstants::boltzmann_constant;
 
 	switch (input_value)
 	{
@@ -130,9 +166,15 @@ void Matrix::setGrainBoundaryVacancyDiffusivity(int input_value)
 			 * 
 			 */
 
-			grain_boundary_diffusivity = 6.9e-04 * exp(- 5.35e-19 / (boltzmann_constant * history_variable[hv["Temperature"]].getFinalValue()));
 			reference += "iGrainBoundaryVacancyDiffusivity: from Reynolds and Burton, JNM, 82 (1979) 22-25.\n\t";
 
+			static thread_local PropertyMemo<1> memo("Grain-boundary vacancy diffusivity, iGrainBoundaryVacancyDiffusivity = 1");
+			const double inputs[] = { history_variable[hv["Temperature"]].getFinalValue() };
+			if (memo.Find(inputs, grain_boundary_diffusivity)) break;
+
+			grain_boundary_diffusivity = 6.9e-04 * reynolds_burton_vacancy_diffusion(inputs[0]);
+			memo.Store(inputs, grain_boundary_diffusivity);
+
 			break;
 		}
 
@@ -143,14 +185,48 @@ void Matrix::setGrainBoundaryVacancyDiffusivity(int input_value)
 			 * 
 			 */
 
-			grain_boundary_diffusivity = 8.86e-6 * exp(- 5.75e-19 / (boltzmann_constant * history_variable[hv["Temperature"]].getFinalValue()));
 			reference += "iGrainBoundaryVacancyDiffusivity: from Pastore et al., JNM, 456 (2015) 156.\n\t";
 
+			static thread_local PropertyMemo<1> memo("Grain-boundary vacancy diffusivity, iGrainBoundaryVacancyDiffusivity = 2");
+			const double inputs[] = { history_variable[hv["Temperature"]].getFinalValue() };
+			if (memo.Find(inputs, grain_boundary_diffusivity)) break;
+
+			grain_boundary_diffusivity = 8.86e-6 * pastore_vacancy_diffusion(inputs[0]);
+			memo.Store(inputs, grain_boundary_diffusivity);
+
 			break;
 		}
+	}
+}
+
+Matrix::Setter Matrix::GrainBoundaryMobilitySetter(int input_value)
+{
+	switch (input_value)
+	{
+		case 0: return &Matrix::setGrainBoundaryMobility<0>;
+		case 1: return &Matrix::setGrainBoundaryMobility<1>;
+		case 2: return &Matrix::setGrainBoundaryMobility<2>;
+
+		default:
+			ErrorMessages::Switch("SetMatrix.cpp", "iGrainGrowth", input_value);
+			return nullptr;
+	}
+}
+
+Matrix::Setter Matrix::GrainBoundaryVacancyDiffusivitySetter(int input_value)
+{
+	switch (input_value)
+	{
+		case 0: return &Matrix::setGrainBoundaryVacancyDiffusivity<0>;
+		case 1: return &Matrix::setGrainBoundaryVacancyDiffusivity<1>;
+		case 2: return &Matrix::setGrainBoundaryVacancyDiffusivity<2>;
 
 		default:
 			ErrorMessages::Switch("SetMatrix.cpp", "iGrainBoundaryVacancyDiffusivity", input_value);
-			break;
+			return nullptr;
 	}
 }
+
+// Options fixed in the definition of the matrices (e.g., UO2HBS)
+template void Matrix::setGrainBoundaryMobility<0>();
+template void Matrix::setGrainBoundaryVacancyDiffusivity<0>();
@@ -16,11 +16,62 @@
 
 #include "SetSystem.h"
 
+/// Temperature factors of the Arrhenius correlations, tabulated with --property-tables (PropertyTable)
+
+static double FissionGasIntrinsicDiffusion(double temperature)
+{
+	return exp(-4.86e-19 / (CONSTANT_NUMBERS_H::PhysicsConstants::boltzmann_constant * temperature));
+}
+
+static double FissionGasIrradiationEnhancedDiffusion(double temperature)
+{
+	return exp(-1.91e-19 / (CONSTANT_NUMBERS_H::PhysicsConstants::boltzmann_constant * temperature));
+}
+
+static double FissionGasMatzkeDiffusion(double temperature) { return exp(-40262.0 / temperature); }
+static double UraniumVacancyS(double temperature) { return exp(-74100/temperature); }
+static double UraniumVacancyG(double temperature) { return exp(-35800/temperature); }
+static double UraniumVacancyDiffusion(double temperature) { return exp(-27800/temperature); }
+static double HeliumLuzziUndamagedDiffusion(double temperature) { return exp(-24603.4 / temperature); }
+static double HeliumLuzziDamagedDiffusion(double temperature) { return exp(-19032.8 / temperature); }
+static double HeliumTalipDiffusion(double temperature) { return exp(-30057.9 / temperature); }
+
+static PropertyTable fission_gas_intrinsic_diffusion("Fission gas diffusivity, exp(-4.86e-19 J / kT)", FissionGasIntrinsicDiffusion);
+static PropertyTable fission_gas_irradiation_enhanced_diffusion("Fission gas diffusivity, exp(-1.91e-19 J / kT)", FissionGasIrradiationEnhancedDiffusion);
+static PropertyTable fission_gas_matzke_diffusion("Fission gas diffusivity, exp(-40262 K / T)", FissionGasMatzkeDiffusion);
+static PropertyTable uranium_vacancy_s("Fission gas diffusivity, exp(-74100 K / T)", UraniumVacancyS);
+static PropertyTable uranium_vacancy_g("Fission gas diffusivity, exp(-35800 K / T)", UraniumVacancyG);
+static PropertyTable uranium_vacancy_diffusion("Fission gas diffusivity, exp(-27800 K / T)", UraniumVacancyDiffusion);
+static PropertyTable helium_luzzi_undamaged_diffusion("Helium diffusivity, exp(-24603.4 K / T)", HeliumLuzziUndamagedDiffusion);
+static PropertyTable helium_luzzi_damaged_diffusion("Helium diffusivity, exp(-19032.8 K / T)", HeliumLuzziDamagedDiffusion);
+static PropertyTable helium_talip_diffusion("Helium diffusivity, exp(-30057.9 K / T)", HeliumTalipDiffusion);
+
+/// Properties of the fission gas systems (System::setFissionGasProperties), shared within the time step
+struct FissionGasProperties
+{
+	bool valid;
+	std::string matrix_name;
+	double radius_in_lattice;
+	double henry_constant;
+
+	double diffusivity;
+	double bubble_diffusivity;
+	double resolution_rate;
+	double trapping_rate;
+	double nucleation_rate;
+	std::string reference;
+};
+
+static thread_local FissionGasProperties fission_gas_properties;
+
 /// SetSystem
 
+template <int iFuelMatrix>
 void SetSystem()
 {
-	switch (int(input_variable[iv["iFuelMatrix"]].getValue()))
+	fission_gas_properties.valid = false;
+
+	switch (iFuelMatrix)
 	{
 		case 0: 
 		{
@@ -81,7 +132,21 @@ void SetSystem()
 	}
 }
 
-void System::setBubbleDiffusivity(int input_value)
+SystemDefinition SetSystemDefinition(int iFuelMatrix)
+{
+	switch (iFuelMatrix)
+	{
+		case 0: return &SetSystem<0>;
+		case 1: return &SetSystem<1>;
+
+		default:
+			ErrorMessages::Switch("SetSystem.cpp", "iFuelMatrix", iFuelMatrix);
+			return nullptr;
+	}
+}
+
+template <int input_value>
+void System::setBubbleDiffusivity()
 {
 	const double boltzmann_constant = 8.6173e-5; // eV
 	const double pi = CONSTANT_NUMBERS_H::MathConstants::pi;
@@ -114,23 +179,18 @@ void System::setBubbleDiffusivity(int input_value)
 			
 			break;
 		}
-
-		default:
-			ErrorMessages::Switch("SetSystem.cpp", "iBubbleDiffusivity", input_value);
-			break;
 	}
 
 }
 
-void System::setFissionGasDiffusivity(int input_value)
+template <int input_value>
+void System::setFissionGasDiffusivity()
 {
 	/** 
 	 * ### setFissionGasDiffusivity
 	 * @brief The intra-granular fission gas (xenon and krypton) diffusivity within the fuel grain is set according to the input_variable iFGDiffusionCoefficient
 	 * 
 	 */
-	const double boltzmann_constant = CONSTANT_NUMBERS_H::PhysicsConstants::boltzmann_constant;
-
 	switch (input_value)
 	{
 	case 0:
@@ -160,12 +220,17 @@ void System::setFissionGasDiffusivity(int input_value)
 		double temperature = history_variable[hv["Temperature"]].getFinalValue();
 		double fission_rate = history_variable[hv["Fission rate"]].getFinalValue();
 
-		double d1 = 7.6e-10 * exp(-4.86e-19 / (boltzmann_constant * temperature));
-		double d2 = 4.0 * 1.41e-25 * sqrt(fission_rate) * exp(-1.91e-19 / (boltzmann_constant * temperature));
+		static thread_local PropertyMemo<3> memo("Fission gas diffusivity, iFGDiffusionCoefficient = 1");
+		const double inputs[] = { temperature, fission_rate, sf_diffusivity };
+		if (memo.Find(inputs, diffusivity)) break;
+
+		double d1 = 7.6e-10 * fission_gas_intrinsic_diffusion(temperature);
+		double d2 = 4.0 * 1.41e-25 * sqrt(fission_rate) * fission_gas_irradiation_enhanced_diffusion(temperature);
 		double d3 = 8.0e-40 * fission_rate;
 
 		diffusivity = d1 + d2 + d3;
 		diffusivity *= sf_diffusivity;
+		memo.Store(inputs, diffusivity);
 
 		break;
 	}
@@ -179,8 +244,14 @@ void System::setFissionGasDiffusivity(int input_value)
 		 */
 
 		reference += "iFGDiffusionCoefficient: Matzke (1980), Radiation Effects, 53, 219-242.\n\t";
-		diffusivity = 5.0e-08 * exp(-40262.0 / history_variable[hv["Temperature"]].getFinalValue());
+
+		static thread_local PropertyMemo<2> memo("Fission gas diffusivity, iFGDiffusionCoefficient = 2");
+		const double inputs[] = { history_variable[hv["Temperature"]].getFinalValue(), sf_diffusivity };
+		if (memo.Find(inputs, diffusivity)) break;
+
+		diffusivity = 5.0e-08 * fission_gas_matzke_diffusion(inputs[0]);
 		diffusivity *= sf_diffusivity;
+		memo.Store(inputs, diffusivity);
 
 		break;
 	}
@@ -198,12 +269,17 @@ void System::setFissionGasDiffusivity(int input_value)
 		double temperature = history_variable[hv["Temperature"]].getFinalValue();
 		double fission_rate = history_variable[hv["Fission rate"]].getFinalValue();
 
-		double d1 = 7.6e-11 * exp(-4.86e-19 / (boltzmann_constant * temperature));
-		double d2 = 1.41e-25 * sqrt(fission_rate) * exp(-1.91e-19 / (boltzmann_constant * temperature));
+		static thread_local PropertyMemo<3> memo("Fission gas diffusivity, iFGDiffusionCoefficient = 3");
+		const double inputs[] = { temperature, fission_rate, sf_diffusivity };
+		if (memo.Find(inputs, diffusivity)) break;
+
+		double d1 = 7.6e-11 * fission_gas_intrinsic_diffusion(temperature);
+		double d2 = 1.41e-25 * sqrt(fission_rate) * fission_gas_irradiation_enhanced_diffusion(temperature);
 		double d3 = 2.0e-40 * fission_rate;
 
 		diffusivity = d1 + d2 + d3;
 		diffusivity *= sf_diffusivity;
+		memo.Store(inputs, diffusivity);
 
 		break;
 	}
@@ -221,12 +297,17 @@ void System::setFissionGasDiffusivity(int input_value)
 		double temperature = history_variable[hv["Temperature"]].getFinalValue();
 		double fission_rate = history_variable[hv["Fission rate"]].getFinalValue();
 
-		double d1 = 7.6e-10 * exp(-4.86e-19 / (boltzmann_constant * temperature));
-		double d2 = 6.64e-25 * sqrt(fission_rate) * exp(-1.91e-19 / (boltzmann_constant * temperature));
+		static thread_local PropertyMemo<3> memo("Fission gas diffusivity, iFGDiffusionCoefficient = 4");
+		const double inputs[] = { temperature, fission_rate, sf_diffusivity };
+		if (memo.Find(inputs, diffusivity)) break;
+
+		double d1 = 7.6e-10 * fission_gas_intrinsic_diffusion(temperature);
+		double d2 = 6.64e-25 * sqrt(fission_rate) * fission_gas_irradiation_enhanced_diffusion(temperature);
 		double d3 = 1.2e-39 * fission_rate;
 
 		diffusivity = d1 + d2 + d3;
 		diffusivity *= sf_diffusivity;
+		memo.Store(inputs, diffusivity);
 
 		break;
 	}
@@ -255,21 +336,26 @@ void System::setFissionGasDiffusivity(int input_value)
 		double temperature = history_variable[hv["Temperature"]].getFinalValue();
 		double fission_rate = history_variable[hv["Fission rate"]].getFinalValue();
 
-		double d1 = 7.6e-10 * exp(-4.86e-19 / (boltzmann_constant * temperature));
-		double d2 = 4.0 * 1.41e-25 * sqrt(fission_rate) * exp(-1.91e-19 / (boltzmann_constant * temperature));
+		static thread_local PropertyMemo<4> memo("Fission gas diffusivity, iFGDiffusionCoefficient = 6");
+		const double inputs[] = { x, temperature, fission_rate, sf_diffusivity };
+		if (memo.Find(inputs, diffusivity)) break;
+
+		double d1 = 7.6e-10 * fission_gas_intrinsic_diffusion(temperature);
+		double d2 = 4.0 * 1.41e-25 * sqrt(fission_rate) * fission_gas_irradiation_enhanced_diffusion(temperature);
 		double d3 = 8.0e-40 * fission_rate;
 
-		double S = exp(-74100/temperature);
-		double G = exp(-35800/temperature);
+		double S = uranium_vacancy_s(temperature);
+		double G = uranium_vacancy_g(temperature);
 		double uranium_vacancies = 0.0;
 
 		uranium_vacancies = S/pow(G,2.0) * (0.5*pow(x,2.0) + G + 0.5*pow((pow(x,4.0) + 4*G*pow(x,2.0)),0.5));
 
-		double d4 = pow(3e-10,2)*1e13*exp(-27800/temperature)*uranium_vacancies;
+		double d4 = pow(3e-10,2)*1e13*uranium_vacancy_diffusion(temperature)*uranium_vacancies;
 
 		diffusivity = d1 + d2 + d3 + d4;
 
 		diffusivity *= sf_diffusivity;
+		memo.Store(inputs, diffusivity);
 
 		break;		
 	}
@@ -287,14 +373,11 @@ void System::setFissionGasDiffusivity(int input_value)
 
 		break;
 	}
-
-	default:
-		ErrorMessages::Switch("SetSystem.cpp", "iFGDiffusionCoefficient", input_value);
-		break;
 	}
 }
 
-void System::setHeliumDiffusivity(int input_value)
+template <int input_value>
+void System::setHeliumDiffusivity()
 {
 
 	/** 
@@ -326,7 +409,13 @@ void System::setHeliumDiffusivity(int input_value)
 		 */
 
 		reference += "(no or very limited lattice damage) L. Luzzi et al., Nuclear Engineering and Design, 330 (2018) 265-271.\n\t";
-		diffusivity = 2.0e-10 * exp(-24603.4 / history_variable[hv["Temperature"]].getFinalValue());
+
+		static thread_local PropertyMemo<1> memo("Helium diffusivity, iHeDiffusivity = 1");
+		const double inputs[] = { history_variable[hv["Temperature"]].getFinalValue() };
+		if (memo.Find(inputs, diffusivity)) break;
+
+		diffusivity = 2.0e-10 * helium_luzzi_undamaged_diffusion(inputs[0]);
+		memo.Store(inputs, diffusivity);
 		break;
 	}
 
@@ -340,7 +429,13 @@ void System::setHeliumDiffusivity(int input_value)
 		 */
 
 		reference += "(significant lattice damage) L. Luzzi et al., Nuclear Engineering and Design, 330 (2018) 265-271.\n\t";
-		diffusivity = 3.3e-10 * exp(-19032.8 / history_variable[hv["Temperature"]].getFinalValue());
+
+		static thread_local PropertyMemo<1> memo("Helium diffusivity, iHeDiffusivity = 2");
+		const double inputs[] = { history_variable[hv["Temperature"]].getFinalValue() };
+		if (memo.Find(inputs, diffusivity)) break;
+
+		diffusivity = 3.3e-10 * helium_luzzi_damaged_diffusion(inputs[0]);
+		memo.Store(inputs, diffusivity);
 		break;
 	}
 
@@ -353,7 +448,13 @@ void System::setHeliumDiffusivity(int input_value)
 		 */
 
 		reference += "iHeDiffusivity: Z. Talip et al. JNM 445 (2014) 117-127.\n\t";
-		diffusivity = 1.0e-7 * exp(-30057.9 / history_variable[hv["Temperature"]].getFinalValue());
+
+		static thread_local PropertyMemo<1> memo("Helium diffusivity, iHeDiffusivity = 3");
+		const double inputs[] = { history_variable[hv["Temperature"]].getFinalValue() };
+		if (memo.Find(inputs, diffusivity)) break;
+
+		diffusivity = 1.0e-7 * helium_talip_diffusion(inputs[0]);
+		memo.Store(inputs, diffusivity);
 		break;
 	}
 
@@ -368,14 +469,11 @@ void System::setHeliumDiffusivity(int input_value)
 		diffusivity = 0.0;
 		break;
 	}
-
-	default:
-		ErrorMessages::Switch("SetSystem.cpp", "iHeDiffusivity", input_value);
-		break;
 	}
 }
 
-void System::setResolutionRate(int input_value)
+template <int input_value>
+void System::setResolutionRate()
 {
 	/** 
 	 * ### setResolutionRate
@@ -410,9 +508,16 @@ void System::setResolutionRate(int input_value)
 		 */
 
 		reference += "iResolutionRate: J.A. Turnbull, JNM, 38 (1971), 203.\n\t";
+
+		static thread_local PropertyMemo<5> memo("Resolution rate, iResolutionRate = 1");
+		const double inputs[] = { matrix[0].getFFrange(), matrix[0].getFFinfluenceRadius(),
+			sciantix_variable[sv["Intragranular bubble radius"]].getFinalValue(), history_variable[hv["Fission rate"]].getFinalValue(), sf_resolution_rate };
+		if (memo.Find(inputs, resolution_rate)) break;
+
 		resolution_rate = 2.0 * pi * matrix[0].getFFrange() * pow(matrix[0].getFFinfluenceRadius()
 			+ sciantix_variable[sv["Intragranular bubble radius"]].getFinalValue(), 2) * history_variable[hv["Fission rate"]].getFinalValue();
 		resolution_rate *= sf_resolution_rate;
+		memo.Store(inputs, resolution_rate);
 
 		break;
 	}
@@ -442,6 +547,12 @@ void System::setResolutionRate(int input_value)
 
 		reference += "iResolutionRate: Cognini et al. NET 53 (2021) 562-571.\n\t";
 
+		static thread_local PropertyMemo<10> memo("Resolution rate, iResolutionRate = 3");
+		const double inputs[] = { matrix[0].getFFrange(), matrix[0].getFFinfluenceRadius(), matrix[0].getOIS(),
+			sciantix_variable[sv["Intragranular bubble radius"]].getFinalValue(), history_variable[hv["Fission rate"]].getFinalValue(),
+			history_variable[hv["Temperature"]].getFinalValue(), diffusivity, henry_constant, radius_in_lattice, sf_resolution_rate };
+		if (memo.Find(inputs, resolution_rate)) break;
+
 		/// @param irradiation_resolution_rate
 		double irradiation_resolution_rate = 2.0 * pi * matrix[0].getFFrange() * pow(matrix[0].getFFinfluenceRadius()
 			+ sciantix_variable[sv["Intragranular bubble radius"]].getFinalValue(), 2) * history_variable[hv["Fission rate"]].getFinalValue();
@@ -468,6 +579,7 @@ void System::setResolutionRate(int input_value)
 
 		resolution_rate = irradiation_resolution_rate + thermal_resolution_rate;
 		resolution_rate *= sf_resolution_rate;
+		memo.Store(inputs, resolution_rate);
 
 		break;
 	}
@@ -483,15 +595,12 @@ void System::setResolutionRate(int input_value)
 		resolution_rate = 0.0;
 		break;
 	}
-
-	default:
-		ErrorMessages::Switch("SetSystem.cpp", "iResolutionRate", input_value);
-		break;
 	}
 	resolution_rate *= sf_resolution_rate;
 }
 
-void System::setTrappingRate(int input_value)
+template <int input_value>
+void System::setTrappingRate()
 {
 	/** 
 	 * ### setTrappingRate
@@ -530,6 +639,11 @@ void System::setTrappingRate(int input_value)
 
 		reference += "iTrappingRate: F.S. Ham, Journal of Physics and Chemistry of Solids, 6 (1958) 335-351.\n\t";
 
+		static thread_local PropertyMemo<5> memo("Trapping rate, iTrappingRate = 1");
+		const double inputs[] = { sciantix_variable[sv["Intragranular bubble concentration"]].getFinalValue(),
+			sciantix_variable[sv["Intragranular bubble radius"]].getFinalValue(), diffusivity, radius_in_lattice, sf_trapping_rate };
+		if (memo.Find(inputs, trapping_rate)) break;
+
 		if (sciantix_variable[sv["Intragranular bubble concentration"]].getFinalValue() == 0.0)
 			trapping_rate = 0.0;
 
@@ -539,6 +653,7 @@ void System::setTrappingRate(int input_value)
 			sciantix_variable[sv["Intragranular bubble concentration"]].getFinalValue();
 
 		trapping_rate *= sf_trapping_rate;
+		memo.Store(inputs, trapping_rate);
 
 
 		break;
@@ -555,14 +670,54 @@ void System::setTrappingRate(int input_value)
 		trapping_rate = 0.0;
 		break;
 	}
-
-	default:
-		ErrorMessages::Switch("SetSystem.cpp", "iTrappingRate", input_value);
-		break;
 	}
 }
 
-void System::setNucleationRate(int input_value)
+void System::setFissionGasProperties()
+{
+	/** 
+	 * ### setFissionGasProperties
+	 * @brief The diffusivity, bubble diffusivity, resolution, trapping and nucleation rates of the fission gas systems (Xe, Kr, Xe133, Kr85m)
+	 * depend only on the matrix, on the input options and on the conditions of the time step.
+	 * They are evaluated by the first system defined in the time step, and copied by the following ones with the same matrix and lattice properties.
+	 * 
+	 */
+	FissionGasProperties& shared = fission_gas_properties;
+
+	if (shared.valid && shared.radius_in_lattice == radius_in_lattice && shared.henry_constant == henry_constant && shared.matrix_name == matrix[0].getName())
+	{
+		diffusivity = shared.diffusivity;
+		bubble_diffusivity = shared.bubble_diffusivity;
+		resolution_rate = shared.resolution_rate;
+		trapping_rate = shared.trapping_rate;
+		nucleation_rate = shared.nucleation_rate;
+		reference += shared.reference;
+
+		return;
+	}
+
+	const std::string::size_type reference_length = reference.size();
+
+	(this->*option_dispatch.fission_gas_diffusivity)();
+	(this->*option_dispatch.bubble_diffusivity)();
+	(this->*option_dispatch.resolution_rate)();
+	(this->*option_dispatch.trapping_rate)();
+	(this->*option_dispatch.nucleation_rate)();
+
+	shared.valid = true;
+	shared.matrix_name = matrix[0].getName();
+	shared.radius_in_lattice = radius_in_lattice;
+	shared.henry_constant = henry_constant;
+	shared.diffusivity = diffusivity;
+	shared.bubble_diffusivity = bubble_diffusivity;
+	shared.resolution_rate = resolution_rate;
+	shared.trapping_rate = trapping_rate;
+	shared.nucleation_rate = nucleation_rate;
+	shared.reference.assign(reference, reference_length, std::string::npos);
+}
+
+template <int input_value>
+void System::setNucleationRate()
 {
 	/** 
 	 * ### setNucleationRate
@@ -612,14 +767,11 @@ void System::setNucleationRate(int input_value)
 
 		break;
 	}
-
-	default:
-		ErrorMessages::Switch("SetSystem.cpp", "inucleation_rate", input_value);
-		break;
 	}
 }
 
-void System::setProductionRate(int input_value)
+template <int input_value>
+void System::setProductionRate()
 {
 	/** 
 	 * ### setProductionRate
@@ -691,10 +843,120 @@ void System::setProductionRate(int input_value)
 
 		break;
 	}
+	}
 
-	default:
-		ErrorMessages::Switch("SetSystem.cpp", "iHeliumProductionRate", input_value);
-		break;
+}
+System::Setter System::BubbleDiffusivitySetter(int input_value)
+{
+	switch (input_value)
+	{
+		case 0: return &System::setBubbleDiffusivity<0>;
+		case 1: return &System::setBubbleDiffusivity<1>;
+
+		default:
+			ErrorMessages::Switch("SetSystem.cpp", "iBubbleDiffusivity", input_value);
+			return nullptr;
 	}
+}
+
+System::Setter System::FissionGasDiffusivitySetter(int input_value)
+{
+	switch (input_value)
+	{
+		case 0: return &System::setFissionGasDiffusivity<0>;
+		case 1: return &System::setFissionGasDiffusivity<1>;
+		case 2: return &System::setFissionGasDiffusivity<2>;
+		case 3: return &System::setFissionGasDiffusivity<3>;
+		case 4: return &System::setFissionGasDiffusivity<4>;
+		case 5: return &System::setFissionGasDiffusivity<5>;
+		case 6: return &System::setFissionGasDiffusivity<6>;
+		case 99: return &System::setFissionGasDiffusivity<99>;
+
+		default:
+			ErrorMessages::Switch("SetSystem.cpp", "iFGDiffusionCoefficient", input_value);
+			return nullptr;
+	}
+}
+
+System::Setter System::HeliumDiffusivitySetter(int input_value)
+{
+	switch (input_value)
+	{
+		case 0: return &System::setHeliumDiffusivity<0>;
+		case 1: return &System::setHeliumDiffusivity<1>;
+		case 2: return &System::setHeliumDiffusivity<2>;
+		case 3: return &System::setHeliumDiffusivity<3>;
+		case 99: return &System::setHeliumDiffusivity<99>;
+
+		default:
+			ErrorMessages::Switch("SetSystem.cpp", "iHeDiffusivity", input_value);
+			return nullptr;
+	}
+}
+
+System::Setter System::ResolutionRateSetter(int input_value)
+{
+	switch (input_value)
+	{
+		case 0: return &System::setResolutionRate<0>;
+		case 1: return &System::setResolutionRate<1>;
+		case 2: return &System::setResolutionRate<2>;
+		case 3: return &System::setResolutionRate<3>;
+		case 99: return &System::setResolutionRate<99>;
+
+		default:
+			ErrorMessages::Switch("SetSystem.cpp", "iResolutionRate", input_value);
+			return nullptr;
+	}
+}
+
+System::Setter System::TrappingRateSetter(int input_value)
+{
+	switch (input_value)
+	{
+		case 0: return &System::setTrappingRate<0>;
+		case 1: return &System::setTrappingRate<1>;
+		case 99: return &System::setTrappingRate<99>;
+
+		default:
+			ErrorMessages::Switch("SetSystem.cpp", "iTrappingRate", input_value);
+			return nullptr;
+	}
+}
+
+System::Setter System::NucleationRateSetter(int input_value)
+{
+	switch (input_value)
+	{
+		case 0: return &System::setNucleationRate<0>;
+		case 1: return &System::setNucleationRate<1>;
+		case 99: return &System::setNucleationRate<99>;
+
+		default:
+			ErrorMessages::Switch("SetSystem.cpp", "inucleation_rate", input_value);
+			return nullptr;
+	}
+}
+
+System::Setter System::ProductionRateSetter(int input_value)
+{
+	switch (input_value)
+	{
+		case 0: return &System::setProductionRate<0>;
+		case 1: return &System::setProductionRate<1>;
+		case 2: return &System::setProductionRate<2>;
+		case 3: return &System::setProductionRate<3>;
+
+		default:
+			ErrorMessages::Switch("SetSystem.cpp", "iHeliumProductionRate", input_value);
+			return nullptr;
+	}
+}
 
-}
\ No newline at end of file
+// Options fixed in the definition of the systems (e.g., Xe_in_UO2HBS, Kr_in_UO2HBS)
+template void System::setProductionRate<1>();
+template void System::setFissionGasDiffusivity<5>();
+template void System::setBubbleDiffusivity<0>();
+template void System::setResolutionRate<99>();
+template void System::setTrappingRate<99>();
+template void System::setNucleationRate<99>();
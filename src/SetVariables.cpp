@@ -24,7 +24,7 @@
 /// - input_variable
 /// together with the diffusion modes, the maps, and the scaling factors.
 
-void SetVariables(int Sciantix_options[], double Sciantix_history[], double Sciantix_variables[], double Sciantix_scaling_factors[], double Sciantix_diffusion_modes[])
+void SetVariables(int Sciantix_options[], double Sciantix_history[], const double Sciantix_variables_start[], double Sciantix_variables[], double Sciantix_scaling_factors[], const double Sciantix_diffusion_modes_start[], double Sciantix_diffusion_modes[])
 {
 	// -----------------------------------------------------------------------------------------------
 	// Input variable
@@ -152,26 +152,16 @@ void SetVariables(int Sciantix_options[], double Sciantix_history[], double Scia
 
 	MapInputVariable();
 
-	bool toOutputRadioactiveFG(0);
-	if (input_variable[iv["iRadioactiveFissionGas"]].getValue() != 0) toOutputRadioactiveFG = 1;
+	// The input settings are resolved once per simulation
+	if (iv_counter) OptionDispatching();
 
-	bool toOutputVenting(0);
-	if (input_variable[iv["iGrainBoundaryVenting"]].getValue() != 0) toOutputVenting = 1;
-
-	bool toOutputHelium(0);
-	if (input_variable[iv["iHelium"]].getValue() != 0) toOutputHelium = 1;
-
-	bool toOutputCracking(0);
-	if (input_variable[iv["iGrainBoundaryMicroCracking"]].getValue() != 0) toOutputCracking = 1;
-
-	bool toOutputGrainBoundary(0);
-	if (input_variable[iv["iGrainBoundaryBehaviour"]].getValue() == 1) toOutputGrainBoundary = 1;
-
-	bool toOutputHighBurnupStructureFormation(0);
-	if (input_variable[iv["iHighBurnupStructureFormation"]].getValue() == 1) toOutputHighBurnupStructureFormation = 1;
-
-	bool toOutputStoichiometryDeviation(0);
-	if (input_variable[iv["iStoichiometryDeviation"]].getValue() > 0) toOutputStoichiometryDeviation = 1;
+	bool toOutputRadioactiveFG(option_dispatch.output_radioactive_fission_gas);
+	bool toOutputVenting(option_dispatch.output_venting);
+	bool toOutputHelium(option_dispatch.output_helium);
+	bool toOutputCracking(option_dispatch.output_cracking);
+	bool toOutputGrainBoundary(option_dispatch.output_grain_boundary);
+	bool toOutputHighBurnupStructureFormation(option_dispatch.output_high_burnup_structure_formation);
+	bool toOutputStoichiometryDeviation(option_dispatch.output_stoichiometry_deviation);
 
 	// ----------------
 	// Physics variable
@@ -243,60 +233,51 @@ void SetVariables(int Sciantix_options[], double Sciantix_history[], double Scia
 	// ----------------------------------------------------------------------------
 	// Sciantix variable
 	// ----------------------------------------------------------------------------
+	// The variables exchanged with the caller (indices 0-69 of Sciantix_variables) are bound at their index, the other ones
+	// take the following slots of the store. The initial values are taken from Sciantix_variables_start (usually the same array),
+	// the final values are copied back to Sciantix_variables at the end of the time step (Sciantix)
+	sciantix_variable_store.bind(Sciantix_variables_start, Sciantix_variables, 70);
+
 	int sv_counter(0);
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(0);
 	sciantix_variable[sv_counter].setName("Grain radius");
 	sciantix_variable[sv_counter].setUOM("(m)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[0]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[0]);
 	sciantix_variable[sv_counter].setOutput(1);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(1);
 	sciantix_variable[sv_counter].setName("Xe produced");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[1]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[1]);
 	sciantix_variable[sv_counter].setOutput(1);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(2);
 	sciantix_variable[sv_counter].setName("Xe in grain");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[2]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[2]);
 	sciantix_variable[sv_counter].setOutput(1);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(3);
 	sciantix_variable[sv_counter].setName("Xe in intragranular solution");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[3]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[3]);
 	sciantix_variable[sv_counter].setOutput(1);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(4);
 	sciantix_variable[sv_counter].setName("Xe in intragranular bubbles");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[4]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[4]);
 	sciantix_variable[sv_counter].setOutput(1);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(5);
 	sciantix_variable[sv_counter].setName("Xe at grain boundary");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[5]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[5]);
 	sciantix_variable[sv_counter].setOutput(1);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(6);
 	sciantix_variable[sv_counter].setName("Xe released");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[6]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[6]);
 	sciantix_variable[sv_counter].setOutput(1);
 	++sv_counter;
 
@@ -304,55 +285,42 @@ void SetVariables(int Sciantix_options[], double Sciantix_history[], double Scia
 	sciantix_variable[sv_counter].setName("Xe decayed");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
 	sciantix_variable[sv_counter].setInitialValue(0.0);
-	sciantix_variable[sv_counter].setFinalValue(0.0);
 	sciantix_variable[sv_counter].setOutput(0);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(7);
 	sciantix_variable[sv_counter].setName("Kr produced");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[7]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[7]);
 	sciantix_variable[sv_counter].setOutput(1);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(8);
 	sciantix_variable[sv_counter].setName("Kr in grain");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[8]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[8]);
 	sciantix_variable[sv_counter].setOutput(1);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(9);
 	sciantix_variable[sv_counter].setName("Kr in intragranular solution");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[9]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[9]);
 	sciantix_variable[sv_counter].setOutput(1);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(10);
 	sciantix_variable[sv_counter].setName("Kr in intragranular bubbles");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[10]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[10]);
 	sciantix_variable[sv_counter].setOutput(1);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(11);
 	sciantix_variable[sv_counter].setName("Kr at grain boundary");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[11]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[11]);
 	sciantix_variable[sv_counter].setOutput(1);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(12);
 	sciantix_variable[sv_counter].setName("Kr released");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[12]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[12]);
 	sciantix_variable[sv_counter].setOutput(1);
 	++sv_counter;
 
@@ -360,7 +328,6 @@ void SetVariables(int Sciantix_options[], double Sciantix_history[], double Scia
 	sciantix_variable[sv_counter].setName("Kr decayed");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
 	sciantix_variable[sv_counter].setInitialValue(0.0);
-	sciantix_variable[sv_counter].setFinalValue(0.0);
 	sciantix_variable[sv_counter].setOutput(0);
 	++sv_counter;
 
@@ -368,55 +335,42 @@ void SetVariables(int Sciantix_options[], double Sciantix_history[], double Scia
 	sciantix_variable[sv_counter].setName("Fission gas release");
 	sciantix_variable[sv_counter].setUOM("(/)");
 	sciantix_variable[sv_counter].setInitialValue(0.0);
-	sciantix_variable[sv_counter].setFinalValue(0.0);
 	sciantix_variable[sv_counter].setOutput(1);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(13);
 	sciantix_variable[sv_counter].setName("He produced");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[13]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[13]);
 	sciantix_variable[sv_counter].setOutput(toOutputHelium);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(14);
 	sciantix_variable[sv_counter].setName("He in grain");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[14]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[14]);
 	sciantix_variable[sv_counter].setOutput(toOutputHelium);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(15);
 	sciantix_variable[sv_counter].setName("He in intragranular solution");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[15]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[15]);
 	sciantix_variable[sv_counter].setOutput(toOutputHelium);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(16);
 	sciantix_variable[sv_counter].setName("He in intragranular bubbles");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[16]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[16]);
 	sciantix_variable[sv_counter].setOutput(toOutputHelium);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(17);
 	sciantix_variable[sv_counter].setName("He at grain boundary");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[17]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[17]);
 	sciantix_variable[sv_counter].setOutput(toOutputHelium);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(18);
 	sciantix_variable[sv_counter].setName("He released");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[18]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[18]);
 	sciantix_variable[sv_counter].setOutput(toOutputHelium);
 	++sv_counter;
 
@@ -424,7 +378,6 @@ void SetVariables(int Sciantix_options[], double Sciantix_history[], double Scia
 	sciantix_variable[sv_counter].setName("He decayed");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
 	sciantix_variable[sv_counter].setInitialValue(0.0);
-	sciantix_variable[sv_counter].setFinalValue(0.0);
 	sciantix_variable[sv_counter].setOutput(0);
 	++sv_counter;
 
@@ -432,7 +385,6 @@ void SetVariables(int Sciantix_options[], double Sciantix_history[], double Scia
 	sciantix_variable[sv_counter].setName("He fractional release");
 	sciantix_variable[sv_counter].setUOM("(/)");
 	sciantix_variable[sv_counter].setInitialValue(0.0);
-	sciantix_variable[sv_counter].setFinalValue(0.0);
 	sciantix_variable[sv_counter].setOutput(toOutputHelium);
 	++sv_counter;
 
@@ -440,63 +392,48 @@ void SetVariables(int Sciantix_options[], double Sciantix_history[], double Scia
 	sciantix_variable[sv_counter].setName("He release rate");
 	sciantix_variable[sv_counter].setUOM("(at/m3 s)");
 	sciantix_variable[sv_counter].setInitialValue(0.0);
-	sciantix_variable[sv_counter].setFinalValue(0.0);
 	sciantix_variable[sv_counter].setOutput(toOutputHelium);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(48);
 	sciantix_variable[sv_counter].setName("Xe133 produced");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[48]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[48]);
 	sciantix_variable[sv_counter].setOutput(toOutputRadioactiveFG);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(49);
 	sciantix_variable[sv_counter].setName("Xe133 in grain");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[49]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[49]);
 	sciantix_variable[sv_counter].setOutput(toOutputRadioactiveFG);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(50);
 	sciantix_variable[sv_counter].setName("Xe133 in intragranular solution");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[50]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[50]);
 	sciantix_variable[sv_counter].setOutput(toOutputRadioactiveFG);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(51);
 	sciantix_variable[sv_counter].setName("Xe133 in intragranular bubbles");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[51]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[51]);
 	sciantix_variable[sv_counter].setOutput(toOutputRadioactiveFG);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(52);
 	sciantix_variable[sv_counter].setName("Xe133 decayed");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[52]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[52]);
 	sciantix_variable[sv_counter].setOutput(toOutputRadioactiveFG);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(53);
 	sciantix_variable[sv_counter].setName("Xe133 at grain boundary");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[53]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[53]);
 	sciantix_variable[sv_counter].setOutput(toOutputRadioactiveFG);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(54);
 	sciantix_variable[sv_counter].setName("Xe133 released");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[54]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[54]);
 	sciantix_variable[sv_counter].setOutput(toOutputRadioactiveFG);
 	++sv_counter;
 
@@ -504,63 +441,48 @@ void SetVariables(int Sciantix_options[], double Sciantix_history[], double Scia
 	sciantix_variable[sv_counter].setName("Xe133 R/B");
 	sciantix_variable[sv_counter].setUOM("(/)");
 	sciantix_variable[sv_counter].setInitialValue(0.0);
-	sciantix_variable[sv_counter].setFinalValue(0.0);
 	sciantix_variable[sv_counter].setOutput(toOutputRadioactiveFG);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(57);
 	sciantix_variable[sv_counter].setName("Kr85m produced");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[57]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[57]);
 	sciantix_variable[sv_counter].setOutput(toOutputRadioactiveFG);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(58);
 	sciantix_variable[sv_counter].setName("Kr85m in grain");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[58]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[58]);
 	sciantix_variable[sv_counter].setOutput(toOutputRadioactiveFG);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(59);
 	sciantix_variable[sv_counter].setName("Kr85m in intragranular solution");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[59]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[59]);
 	sciantix_variable[sv_counter].setOutput(toOutputRadioactiveFG);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(60);
 	sciantix_variable[sv_counter].setName("Kr85m in intragranular bubbles");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[60]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[60]);
 	sciantix_variable[sv_counter].setOutput(toOutputRadioactiveFG);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(61);
 	sciantix_variable[sv_counter].setName("Kr85m decayed");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[61]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[61]);
 	sciantix_variable[sv_counter].setOutput(toOutputRadioactiveFG);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(62);
 	sciantix_variable[sv_counter].setName("Kr85m at grain boundary");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[62]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[62]);
 	sciantix_variable[sv_counter].setOutput(toOutputRadioactiveFG);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(63);
 	sciantix_variable[sv_counter].setName("Kr85m released");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[63]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[63]);
 	sciantix_variable[sv_counter].setOutput(toOutputRadioactiveFG);
 	++sv_counter;
 
@@ -568,23 +490,18 @@ void SetVariables(int Sciantix_options[], double Sciantix_history[], double Scia
 	sciantix_variable[sv_counter].setName("Kr85m R/B");
 	sciantix_variable[sv_counter].setUOM("(/)");
 	sciantix_variable[sv_counter].setInitialValue(0.0);
-	sciantix_variable[sv_counter].setFinalValue(0.0);
 	sciantix_variable[sv_counter].setOutput(toOutputRadioactiveFG);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(19);
 	sciantix_variable[sv_counter].setName("Intragranular bubble concentration");
 	sciantix_variable[sv_counter].setUOM("(bub/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[19]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[19]);
 	sciantix_variable[sv_counter].setOutput(1);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(20);
 	sciantix_variable[sv_counter].setName("Intragranular bubble radius");
 	sciantix_variable[sv_counter].setUOM("(m)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[20]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[20]);
 	sciantix_variable[sv_counter].setOutput(1);
 	++sv_counter;
 
@@ -592,95 +509,73 @@ void SetVariables(int Sciantix_options[], double Sciantix_history[], double Scia
 	sciantix_variable[sv_counter].setName("Intragranular bubble volume");
 	sciantix_variable[sv_counter].setUOM("(m3)");
 	sciantix_variable[sv_counter].setInitialValue(0.0);
-	sciantix_variable[sv_counter].setFinalValue(0.0);
 	sciantix_variable[sv_counter].setOutput(0);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(21);
 	sciantix_variable[sv_counter].setName("Intragranular Xe atoms per bubble");
 	sciantix_variable[sv_counter].setUOM("(at/bub)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[21]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[21]);
 	sciantix_variable[sv_counter].setOutput(0);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(22);
 	sciantix_variable[sv_counter].setName("Intragranular Kr atoms per bubble");
 	sciantix_variable[sv_counter].setUOM("(at/bub)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[22]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[22]);
 	sciantix_variable[sv_counter].setOutput(0);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(23);
 	sciantix_variable[sv_counter].setName("Intragranular He atoms per bubble");
 	sciantix_variable[sv_counter].setUOM("(at/bub)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[23]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[23]);
 	sciantix_variable[sv_counter].setOutput(0);
 	++sv_counter;
 
 	sciantix_variable.emplace_back();
 	sciantix_variable[sv_counter].setName("Intragranular atoms per bubble");
 	sciantix_variable[sv_counter].setUOM("(at/bub)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[21] + Sciantix_variables[22] + Sciantix_variables[23]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[21] + Sciantix_variables[22] + Sciantix_variables[23]);
+	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables_start[21] + Sciantix_variables_start[22] + Sciantix_variables_start[23]);
 	sciantix_variable[sv_counter].setOutput(0);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(24);
 	sciantix_variable[sv_counter].setName("Intragranular gas swelling");
 	sciantix_variable[sv_counter].setUOM("(/)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[24]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[24]);
 	sciantix_variable[sv_counter].setOutput(1);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(25);
 	sciantix_variable[sv_counter].setName("Intergranular bubble concentration");
 	sciantix_variable[sv_counter].setUOM("(bub/m2)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[25]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[25]);
 	sciantix_variable[sv_counter].setOutput(toOutputGrainBoundary);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(26);
 	sciantix_variable[sv_counter].setName("Intergranular Xe atoms per bubble");
 	sciantix_variable[sv_counter].setUOM("(at/bub)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[26]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[26]);
 	sciantix_variable[sv_counter].setOutput(0);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(27);
 	sciantix_variable[sv_counter].setName("Intergranular Kr atoms per bubble");
 	sciantix_variable[sv_counter].setUOM("(at/bub)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[27]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[27]);
 	sciantix_variable[sv_counter].setOutput(0);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(28);
 	sciantix_variable[sv_counter].setName("Intergranular He atoms per bubble");
 	sciantix_variable[sv_counter].setUOM("(at/bub)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[28]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[28]);
 	sciantix_variable[sv_counter].setOutput(0);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(29);
 	sciantix_variable[sv_counter].setName("Intergranular atoms per bubble");
 	sciantix_variable[sv_counter].setUOM("(at/bub)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[29]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[29]);
 	sciantix_variable[sv_counter].setOutput(toOutputGrainBoundary);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(30);
 	sciantix_variable[sv_counter].setName("Intergranular vacancies per bubble");
 	sciantix_variable[sv_counter].setUOM("(vac/bub)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[30]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[30]);
 	sciantix_variable[sv_counter].setOutput(toOutputGrainBoundary);
 	++sv_counter;
 
@@ -688,191 +583,145 @@ void SetVariables(int Sciantix_options[], double Sciantix_history[], double Scia
 	sciantix_variable[sv_counter].setName("Intergranular bubble pressure");
 	sciantix_variable[sv_counter].setUOM("MPa)");
 	sciantix_variable[sv_counter].setInitialValue(0.0);
-	sciantix_variable[sv_counter].setFinalValue(0.0);
 	sciantix_variable[sv_counter].setOutput(0);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(31);
 	sciantix_variable[sv_counter].setName("Intergranular bubble radius");
 	sciantix_variable[sv_counter].setUOM("(m)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[31]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[31]);
 	sciantix_variable[sv_counter].setOutput(toOutputGrainBoundary);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(32);
 	sciantix_variable[sv_counter].setName("Intergranular bubble area");
 	sciantix_variable[sv_counter].setUOM("(m2)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[32]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[32]);
 	sciantix_variable[sv_counter].setOutput(toOutputGrainBoundary);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(33);
 	sciantix_variable[sv_counter].setName("Intergranular bubble volume");
 	sciantix_variable[sv_counter].setUOM("(m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[33]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[33]);
 	sciantix_variable[sv_counter].setOutput(toOutputGrainBoundary);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(34);
 	sciantix_variable[sv_counter].setName("Intergranular fractional coverage");
 	sciantix_variable[sv_counter].setUOM("(/)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[34]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[34]);
 	sciantix_variable[sv_counter].setOutput(toOutputGrainBoundary);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(35);
 	sciantix_variable[sv_counter].setName("Intergranular saturation fractional coverage");
 	sciantix_variable[sv_counter].setUOM("(/)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[35]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[35]);
 	sciantix_variable[sv_counter].setOutput(toOutputGrainBoundary);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(36);
 	sciantix_variable[sv_counter].setName("Intergranular gas swelling");
 	sciantix_variable[sv_counter].setUOM("(/)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[36]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[36]);
 	sciantix_variable[sv_counter].setOutput(toOutputGrainBoundary);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(37);
 	sciantix_variable[sv_counter].setName("Intergranular fractional intactness");
 	sciantix_variable[sv_counter].setUOM("(/)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[37]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[37]);
 	sciantix_variable[sv_counter].setOutput(toOutputCracking);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(38);
 	sciantix_variable[sv_counter].setName("Burnup");
 	sciantix_variable[sv_counter].setUOM("(MWd/kgUO2)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[38]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[38]);
 	sciantix_variable[sv_counter].setOutput(1);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(69);
 	sciantix_variable[sv_counter].setName("FIMA");
 	sciantix_variable[sv_counter].setUOM("(%)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[69]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[69]);
 	sciantix_variable[sv_counter].setOutput(0);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(39);
 	sciantix_variable[sv_counter].setName("Effective burnup");
 	sciantix_variable[sv_counter].setUOM("(MWd/kgUO2)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[39]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[39]);
 	sciantix_variable[sv_counter].setOutput(toOutputHighBurnupStructureFormation);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(65);
 	sciantix_variable[sv_counter].setName("Irradiation time");
 	sciantix_variable[sv_counter].setUOM("(h)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[65]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[65]);
 	sciantix_variable[sv_counter].setOutput(0);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(40);
 	sciantix_variable[sv_counter].setName("Fuel density");
 	sciantix_variable[sv_counter].setUOM("(kg/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[40]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[40]);
 	sciantix_variable[sv_counter].setOutput(toOutputHighBurnupStructureFormation);
 	++sv_counter;
 
 	sciantix_variable.emplace_back();
 	sciantix_variable[sv_counter].setName("U");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[41] + Sciantix_variables[42] + Sciantix_variables[43] + Sciantix_variables[44] + Sciantix_variables[45]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[41] + Sciantix_variables[42] + Sciantix_variables[43] + Sciantix_variables[44] + Sciantix_variables[45]);
+	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables_start[41] + Sciantix_variables_start[42] + Sciantix_variables_start[43] + Sciantix_variables_start[44] + Sciantix_variables_start[45]);
 	sciantix_variable[sv_counter].setOutput(0);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(41);
 	sciantix_variable[sv_counter].setName("U234");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[41]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[41]);
 	sciantix_variable[sv_counter].setOutput(0);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(42);
 	sciantix_variable[sv_counter].setName("U235");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[42]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[42]);
 	sciantix_variable[sv_counter].setOutput(1);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(43);
 	sciantix_variable[sv_counter].setName("U236");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[43]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[43]);
 	sciantix_variable[sv_counter].setOutput(0);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(44);
 	sciantix_variable[sv_counter].setName("U237");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[44]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[44]);
 	sciantix_variable[sv_counter].setOutput(0);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(45);
 	sciantix_variable[sv_counter].setName("U238");
 	sciantix_variable[sv_counter].setUOM("(at/m3)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[45]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[45]);
 	sciantix_variable[sv_counter].setOutput(1);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(46);
 	sciantix_variable[sv_counter].setName("Intergranular vented fraction");
 	sciantix_variable[sv_counter].setUOM("(/)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[46]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[46]);
 	sciantix_variable[sv_counter].setOutput(toOutputVenting);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(47);
 	sciantix_variable[sv_counter].setName("Intergranular venting probability");
 	sciantix_variable[sv_counter].setUOM("(/)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[47]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[47]);
 	sciantix_variable[sv_counter].setOutput(toOutputVenting);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(55);
 	sciantix_variable[sv_counter].setName("Restructured volume fraction");
 	sciantix_variable[sv_counter].setUOM("(/)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[55]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[55]);
 	sciantix_variable[sv_counter].setOutput(toOutputHighBurnupStructureFormation);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(56);
 	sciantix_variable[sv_counter].setName("HBS porosity");
 	sciantix_variable[sv_counter].setUOM("(/)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[56]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[56]);
 	sciantix_variable[sv_counter].setOutput(toOutputHighBurnupStructureFormation);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(64);
 	sciantix_variable[sv_counter].setName("Intragranular similarity ratio");
 	sciantix_variable[sv_counter].setUOM("(/)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[64]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[64]);
 	sciantix_variable[sv_counter].setOutput(0);
 	++sv_counter;
 
@@ -880,7 +729,6 @@ void SetVariables(int Sciantix_options[], double Sciantix_history[], double Scia
 	sciantix_variable[sv_counter].setName("Specific power");
 	sciantix_variable[sv_counter].setUOM("(MW/kg)");
 	sciantix_variable[sv_counter].setInitialValue(0.0);
-	sciantix_variable[sv_counter].setFinalValue(0.0);
 	sciantix_variable[sv_counter].setOutput(0);
 	++sv_counter;
 
@@ -888,15 +736,12 @@ void SetVariables(int Sciantix_options[], double Sciantix_history[], double Scia
 	sciantix_variable[sv_counter].setName("Gap oxygen partial pressure");
 	sciantix_variable[sv_counter].setUOM("(MPa)");
 	sciantix_variable[sv_counter].setInitialValue(0.0);
-	sciantix_variable[sv_counter].setFinalValue(0.0);
 	sciantix_variable[sv_counter].setOutput(toOutputStoichiometryDeviation);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(66);
 	sciantix_variable[sv_counter].setName("Stoichiometry deviation");
 	sciantix_variable[sv_counter].setUOM("(/)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[66]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[66]);
 	sciantix_variable[sv_counter].setOutput(toOutputStoichiometryDeviation);
 	++sv_counter;
 
@@ -904,15 +749,12 @@ void SetVariables(int Sciantix_options[], double Sciantix_history[], double Scia
 	sciantix_variable[sv_counter].setName("Equilibrium stoichiometry deviation");
 	sciantix_variable[sv_counter].setUOM("(/)");
 	sciantix_variable[sv_counter].setInitialValue(0.0);
-	sciantix_variable[sv_counter].setFinalValue(0.0);
 	sciantix_variable[sv_counter].setOutput(toOutputStoichiometryDeviation);
 	++sv_counter;
 
-	sciantix_variable.emplace_back();
+	sciantix_variable.emplace_back(67);
 	sciantix_variable[sv_counter].setName("Fuel oxygen partial pressure");
 	sciantix_variable[sv_counter].setUOM("(MPa)");
-	sciantix_variable[sv_counter].setInitialValue(Sciantix_variables[67]);
-	sciantix_variable[sv_counter].setFinalValue(Sciantix_variables[67]);
 	sciantix_variable[sv_counter].setOutput(toOutputStoichiometryDeviation);
 	++sv_counter;
 
@@ -920,7 +762,6 @@ void SetVariables(int Sciantix_options[], double Sciantix_history[], double Scia
 	sciantix_variable[sv_counter].setName("Fuel oxygen potential");
 	sciantix_variable[sv_counter].setUOM("(KJ/mol)");
 	sciantix_variable[sv_counter].setInitialValue(0.0);
-	sciantix_variable[sv_counter].setFinalValue(0.0);
 	sciantix_variable[sv_counter].setOutput(toOutputStoichiometryDeviation);
 	++sv_counter;
 
@@ -928,31 +769,20 @@ void SetVariables(int Sciantix_options[], double Sciantix_history[], double Scia
 	sciantix_variable[sv_counter].setName("Specific power");
 	sciantix_variable[sv_counter].setUOM("(MW/kg)");
 	sciantix_variable[sv_counter].setInitialValue(0.0);
-	sciantix_variable[sv_counter].setFinalValue(0.0);
 	sciantix_variable[sv_counter].setOutput(0);
 	++sv_counter;
 
+	// The sciantix variables are constant until the models evolve them
+	sciantix_variable_store.setConstant();
+
 	// ---------------
 	// Diffusion modes
 	// ---------------
-	for (int i = 0; i < n_modes; ++i)
-	{
-		modes_initial_conditions[i] = Sciantix_diffusion_modes[i];
-		modes_initial_conditions[1 * n_modes + i] = Sciantix_diffusion_modes[1 * n_modes + i];
-		modes_initial_conditions[2 * n_modes + i] = Sciantix_diffusion_modes[2 * n_modes + i];
-		modes_initial_conditions[3 * n_modes + i] = Sciantix_diffusion_modes[3 * n_modes + i];
-		modes_initial_conditions[4 * n_modes + i] = Sciantix_diffusion_modes[4 * n_modes + i];
-		modes_initial_conditions[5 * n_modes + i] = Sciantix_diffusion_modes[5 * n_modes + i];
-		modes_initial_conditions[6 * n_modes + i] = Sciantix_diffusion_modes[6 * n_modes + i];
-		modes_initial_conditions[7 * n_modes + i] = Sciantix_diffusion_modes[7 * n_modes + i];
-		modes_initial_conditions[8 * n_modes + i] = Sciantix_diffusion_modes[8 * n_modes + i];
-		modes_initial_conditions[9 * n_modes + i] = Sciantix_diffusion_modes[9 * n_modes + i];
-		modes_initial_conditions[10 * n_modes + i] = Sciantix_diffusion_modes[10 * n_modes + i];
-		modes_initial_conditions[11 * n_modes + i] = Sciantix_diffusion_modes[11 * n_modes + i];
-		modes_initial_conditions[12 * n_modes + i] = Sciantix_diffusion_modes[12 * n_modes + i];
-		modes_initial_conditions[13 * n_modes + i] = Sciantix_diffusion_modes[13 * n_modes + i];
-		modes_initial_conditions[14 * n_modes + i] = Sciantix_diffusion_modes[14 * n_modes + i];
-	}
+	// The modes are evolved in place in Sciantix_diffusion_modes, starting from Sciantix_diffusion_modes_start:
+	// when the two differ, each block of modes is copied when first used (DiffusionModes)
+	modes_initial_conditions = Sciantix_diffusion_modes;
+	modes_start = Sciantix_diffusion_modes_start;
+	modes_copied = 0;
 
 	// ---------------
 	// Scaling factors
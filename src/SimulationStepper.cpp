@@ -0,0 +1,118 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+/// SimulationStepper
+/// This routine advances a SCIANTIX simulation driven by the input files one time step at a time (SimulationStepper.h):
+/// the time steps are the ones of RunSimulation, which uses it to run all of them at once.
+
+#include "SimulationStepper.h"
+
+bool SimulationStepper::finished() const
+{
+	return !running || Time_h > Time_end_h;
+}
+
+bool SimulationStepper::step()
+{
+	if (finished()) return false;
+
+	step_number = Time_step_number;
+	step_time_h = Time_h;
+	step_time_s = Time_s;
+
+	running = SimulationTimeStep();
+	return true;
+}
+
+bool SimulationStepper::advanceTo(double time_h)
+{
+	while (Time_h <= time_h && step());
+	return !finished();
+}
+
+double SimulationStepper::getTime() const
+{
+	return Time_h;
+}
+
+CheckpointState SimulationStepper::getState() const
+{
+	CheckpointState state;
+	CheckpointSave(state);
+	state.time_step_number = step_number;
+	state.time_h = step_time_h;
+	state.time_s = step_time_s;
+	return state;
+}
+
+void SimulationStepper::finish()
+{
+	if (!Checkpoint_file.empty()) CheckpointWrite(Simulation_directory + Checkpoint_file);
+
+	if (Solver_output) SolverReport(Simulation_directory + "solver_report.txt");
+	if (Property_memo_output) PropertyMemoReport(Simulation_directory + "property_memo_report.txt");
+}
+
+void SimulationStepper::readInput()
+{
+	// The input variables are defined only once in a simulation and the solver accumulates its statistics
+	input_variable.clear();
+	solver = Solver();
+	PropertyMemoReset();
+
+	InputReading();
+}
+
+void SimulationStepper::resume(const CheckpointState& state)
+{
+	step_number = state.time_step_number;
+	step_time_h = state.time_h;
+	step_time_s = state.time_s;
+	running = CheckpointResume(state);
+}
+
+SimulationStepper::SimulationStepper() : running(true), step_number(0), step_time_h(0.0), step_time_s(0.0)
+{
+	readInput();
+
+	// A resumed simulation takes its state from the checkpoint, and continues output.txt
+	if (Resume_file.empty())
+	{
+		Initialization();
+		remove((Simulation_directory + "output.txt").c_str());
+	}
+	else
+	{
+		CheckpointState state;
+		CheckpointRead(Resume_file, state);
+		resume(state);
+	}
+}
+
+SimulationStepper::SimulationStepper(const std::string& directory, const CheckpointState& state) :
+	running(true), step_number(0), step_time_h(0.0), step_time_s(0.0)
+{
+	Simulation_directory = directory;
+	readInput();
+
+	double scaling_factors[10];
+	std::copy(Sciantix_scaling_factors, Sciantix_scaling_factors + 10, scaling_factors);
+	const bool directory_scaling_factors = std::ifstream(directory + "input_scaling_factors.txt").good();
+
+	resume(state);
+
+	if (directory_scaling_factors)
+		std::copy(scaling_factors, scaling_factors + 10, Sciantix_scaling_factors);
+}
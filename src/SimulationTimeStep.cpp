@@ -0,0 +1,72 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+/// SimulationTimeStep
+/// This routine performs one time step of a SCIANTIX simulation driven by the input history (MainVariables):
+/// interpolation of the input history at the current time, call to Sciantix, and calculation of the next time step.
+/// Returns false once the end of the input history has been reached.
+/// The state of the simulation is thread_local, hence independent simulations (grains) can be advanced in different threads.
+
+#include "SimulationTimeStep.h"
+
+bool SimulationTimeStep()
+{
+	TraceBegin("Time step");
+
+	StageBegin("InputInterpolation");
+	Sciantix_history[0] = Sciantix_history[1];
+	Sciantix_history[1] = InputInterpolation(Time_h, Time_input, Temperature_input, Input_history_points);
+	Sciantix_history[2] = Sciantix_history[3];
+	Sciantix_history[3] = InputInterpolation(Time_h, Time_input, Fissionrate_input, Input_history_points);
+	if (Sciantix_history[3] < 0.0) Sciantix_history[3] = 0.0;
+	Sciantix_history[4] = Sciantix_history[5];
+	Sciantix_history[5] = InputInterpolation(Time_h, Time_input, Hydrostaticstress_input, Input_history_points);
+	Sciantix_history[7] = Time_h;
+	Sciantix_history[8] = static_cast<double>(Time_step_number);
+	Sciantix_history[9] = Sciantix_history[10];
+	Sciantix_history[10] = InputInterpolation(Time_h, Time_input, Steampressure_input, Input_history_points);
+	StageEnd("InputInterpolation");
+
+	TraceCounter("Time step size (s)", Sciantix_history[6]);
+
+	Sciantix(Sciantix_options, Sciantix_history, Sciantix_variables, Sciantix_scaling_factors, Sciantix_diffusion_modes);
+
+	TraceCounter("Newton iterations", solver.newton_iterations);
+	TraceCounter("Active diffusion modes", solver.diffusion_modes);
+	solver.newton_iterations = 0;
+	solver.diffusion_modes = 0;
+	SolverConvergenceTimeStep(Time_step_number, Time_h);
+
+	CheckpointTimeStep();
+
+	StageBegin("TimeStepCalculation");
+	dTime_h = TimeStepCalculation();
+	Sciantix_history[6] = dTime_h * 3600;
+	StageEnd("TimeStepCalculation");
+
+	AllocationCountingTimeStep(Time_step_number);
+
+	TraceEnd("Time step");
+
+	if (Time_h < Time_end_h)
+	{
+		Time_step_number++;
+		Time_h += dTime_h;
+		Time_s += Sciantix_history[6];
+		return true;
+	}
+	else return false;
+}
@@ -17,4 +17,4 @@
 #include "SolverDeclaration.h"
 
 /// SolverDeclaration
-Solver solver;
+thread_local Solver solver;
@@ -0,0 +1,86 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "SolverReport.h"
+
+struct SolverNonConvergence
+{
+	long long int time_step_number;
+	double time_h;
+	int solver_index;
+	unsigned long int not_converged;
+	double max_residual;
+};
+
+// Only the first events are listed, a persistent non-convergence would otherwise fill the report
+const std::vector<SolverNonConvergence>::size_type solver_events_max = 1000;
+static thread_local std::vector<SolverNonConvergence> solver_events;
+static thread_local unsigned long int solver_events_skipped(0);
+
+void SolverConvergenceTimeStep(long long int time_step_number, double time_h)
+{
+	for (int i = 0; i < ITERATIVE_SOLVERS; ++i)
+	{
+		if (solver.step_convergence[i].not_converged == 0) continue;
+
+		if (solver_events.size() < solver_events_max)
+		{
+			SolverNonConvergence event = { time_step_number, time_h, i, solver.step_convergence[i].not_converged, solver.step_convergence[i].max_residual };
+			solver_events.push_back(event);
+		}
+		else
+			solver_events_skipped++;
+	}
+
+	solver.ResetStepConvergence();
+}
+
+void SolverReport(std::string file_name)
+{
+	std::ofstream report_file;
+	report_file.open(file_name, std::ios::out);
+
+	report_file << "Solver\tCalls\tIterations\tIterations per call\tMax iterations per call\tNon-converged calls\tMax final residual\t" << std::endl;
+	for (int i = 0; i < ITERATIVE_SOLVERS; ++i)
+	{
+		const SolverConvergence& record = solver.run_convergence[i];
+
+		report_file << Solver::IterativeSolverName(i) << "\t" << record.calls << "\t" << record.iterations << "\t";
+		if (record.calls > 0)
+			report_file << std::fixed << std::setprecision(3) << (double)record.iterations / record.calls << "\t";
+		else
+			report_file << "n/a\t";
+		report_file << record.max_iterations << "\t" << record.not_converged << "\t";
+		report_file << std::scientific << std::setprecision(6) << record.max_residual << "\t" << std::endl;
+	}
+
+	report_file << "\n";
+	report_file << "Non-convergence events" << std::endl;
+	report_file << "Time step\tTime (h)\tSolver\tNon-converged calls\tMax final residual\t" << std::endl;
+	for (std::vector<SolverNonConvergence>::size_type e = 0; e < solver_events.size(); ++e)
+	{
+		report_file << solver_events[e].time_step_number << "\t" << std::scientific << std::setprecision(6) << solver_events[e].time_h << "\t"
+			<< Solver::IterativeSolverName(solver_events[e].solver_index) << "\t" << solver_events[e].not_converged << "\t"
+			<< solver_events[e].max_residual << "\t" << std::endl;
+	}
+	if (solver_events_skipped > 0)
+		report_file << "(" << solver_events_skipped << " further events not listed)" << std::endl;
+
+	report_file.close();
+
+	solver_events.clear();
+	solver_events_skipped = 0;
+}
@@ -0,0 +1,44 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "Stage.h"
+
+// The heap allocations are attributed to the stages from the start of the instrumented build
+#ifdef SCIANTIX_ALLOCATION_COUNTING
+thread_local bool stage_instrumentation(true);
+#else
+thread_local bool stage_instrumentation(false);
+#endif
+
+void StageInstrumentationUpdate()
+{
+	stage_instrumentation = trace_enabled || performance_counters_enabled || allocation_counting_enabled;
+}
+
+void StageInstrumentationBegin(const char* stage_name)
+{
+	TraceBegin(stage_name);
+	PerformanceCountersBegin();
+	AllocationCountingBegin(stage_name);
+}
+
+void StageInstrumentationEnd(const char* stage_name)
+{
+	// The counters are read before writing the trace, to exclude the trace output from the counts
+	AllocationCountingEnd();
+	PerformanceCountersEnd(stage_name);
+	TraceEnd(stage_name);
+}
@@ -16,6 +16,7 @@
 
 #include "StoichiometryDeviation.h"
 
+template <int iStoichiometryDeviation>
 void StoichiometryDeviation()
 {
   /**
@@ -24,18 +25,16 @@ void StoichiometryDeviation()
    * 
    */
 
-	if (!input_variable[iv["iStoichiometryDeviation"]].getValue()) return;
-
   model.emplace_back();
   int model_index = int(model.size()) - 1;
 
   std::string reference;
-  std::vector<double> parameter;
+  ModelParameter parameter;
   
   double surface_to_volume = 3 / sciantix_variable[sv["Grain radius"]].getFinalValue(); // (1/m)
 
   model[model_index].setName("Stoichiometry deviation");
-  switch (int(input_variable[iv["iStoichiometryDeviation"]].getValue()))
+  switch (iStoichiometryDeviation)
   {
     case 0 :
     {
@@ -46,8 +45,8 @@ void StoichiometryDeviation()
 
       reference += "not considered.";
 
-      parameter.push_back(0);
-      parameter.push_back(0);
+      parameter.stoichiometry_deviation.decay_rate = 0;
+      parameter.stoichiometry_deviation.source_term = 0;
 
       model[model_index].setParameter(parameter);
       model[model_index].setRef(reference);
@@ -84,8 +83,8 @@ void StoichiometryDeviation()
       double decay_rate = surface_exchange_coefficient * sqrt(history_variable[hv["Steam pressure"]].getFinalValue()) * surface_to_volume; 
       double source_rate = surface_exchange_coefficient * sqrt(history_variable[hv["Steam pressure"]].getFinalValue()) * sciantix_variable[sv["Equilibrium stoichiometry deviation"]].getFinalValue() * surface_to_volume;
 
-      parameter.push_back(decay_rate);
-      parameter.push_back(source_rate);
+      parameter.stoichiometry_deviation.decay_rate = decay_rate;
+      parameter.stoichiometry_deviation.source_term = source_rate;
     
       model[model_index].setParameter(parameter);
       model[model_index].setRef(reference);
@@ -122,8 +121,8 @@ void StoichiometryDeviation()
       double decay_rate = surface_exchange_coefficient * sqrt(history_variable[hv["Steam pressure"]].getFinalValue()) * (surface_to_volume); 
       double source_rate = surface_exchange_coefficient * sqrt(history_variable[hv["Steam pressure"]].getFinalValue())  * sciantix_variable[sv["Equilibrium stoichiometry deviation"]].getFinalValue() * (surface_to_volume);
 
-      parameter.push_back(decay_rate);
-      parameter.push_back(source_rate);
+      parameter.stoichiometry_deviation.decay_rate = decay_rate;
+      parameter.stoichiometry_deviation.source_term = source_rate;
 
       model[model_index].setParameter(parameter);
       model[model_index].setRef(reference);
@@ -161,8 +160,8 @@ void StoichiometryDeviation()
       double decay_rate = surface_exchange_coefficient * sqrt(history_variable[hv["Steam pressure"]].getFinalValue()) * (surface_to_volume); 
       double source_rate = surface_exchange_coefficient * sqrt(history_variable[hv["Steam pressure"]].getFinalValue()) * sciantix_variable[sv["Equilibrium stoichiometry deviation"]].getFinalValue() * (surface_to_volume);
 
-      parameter.push_back(decay_rate);
-      parameter.push_back(source_rate);
+      parameter.stoichiometry_deviation.decay_rate = decay_rate;
+      parameter.stoichiometry_deviation.source_term = source_rate;
 
       model[model_index].setParameter(parameter);
       model[model_index].setRef(reference);
@@ -199,8 +198,8 @@ void StoichiometryDeviation()
       double decay_rate = surface_exchange_coefficient * sqrt(history_variable[hv["Steam pressure"]].getFinalValue()/0.12) * surface_to_volume; 
       double source_rate = surface_exchange_coefficient * sqrt(history_variable[hv["Steam pressure"]].getFinalValue()/0.12) * sciantix_variable[sv["Equilibrium stoichiometry deviation"]].getFinalValue() * surface_to_volume;
 
-      parameter.push_back(decay_rate);
-      parameter.push_back(source_rate);
+      parameter.stoichiometry_deviation.decay_rate = decay_rate;
+      parameter.stoichiometry_deviation.source_term = source_rate;
 
       model[model_index].setParameter(parameter);
       model[model_index].setRef(reference);
@@ -245,9 +244,9 @@ void StoichiometryDeviation()
       double alpha = 57/2;
       double K = tau_inv*theta;
 
-      parameter.push_back(K);
-      parameter.push_back(beta);
-      parameter.push_back(alpha);
+      parameter.stoichiometry_deviation_langmuir.K = K;
+      parameter.stoichiometry_deviation_langmuir.beta = beta;
+      parameter.stoichiometry_deviation_langmuir.alpha = alpha;
 
       model[model_index].setParameter(parameter);
       model[model_index].setRef(reference);
@@ -296,20 +295,40 @@ void StoichiometryDeviation()
       double alpha = 57/2;
       double K = tau_inv*theta;
 
-      parameter.push_back(K);
-      parameter.push_back(beta);
-      parameter.push_back(alpha);
+      parameter.stoichiometry_deviation_langmuir.K = K;
+      parameter.stoichiometry_deviation_langmuir.beta = beta;
+      parameter.stoichiometry_deviation_langmuir.alpha = alpha;
 
       model[model_index].setParameter(parameter);
       model[model_index].setRef(reference);
 
       break;
     }
+  }
+}
 
+template void StoichiometryDeviation<0>();
+template void StoichiometryDeviation<1>();
+template void StoichiometryDeviation<2>();
+template void StoichiometryDeviation<3>();
+template void StoichiometryDeviation<4>();
+template void StoichiometryDeviation<5>();
+template void StoichiometryDeviation<6>();
 
-    
-    default :
-      ErrorMessages::Switch("StoichiometryDeviation.cpp", "iStoichiometryDeviation", int(input_variable[iv["iStoichiometryDeviation"]].getValue()));
-      break;
-  }
+ModelDefinition StoichiometryDeviationDefinition(int iStoichiometryDeviation)
+{
+	switch (iStoichiometryDeviation)
+	{
+		case 0: return &StoichiometryDeviation<0>;
+		case 1: return &StoichiometryDeviation<1>;
+		case 2: return &StoichiometryDeviation<2>;
+		case 3: return &StoichiometryDeviation<3>;
+		case 4: return &StoichiometryDeviation<4>;
+		case 5: return &StoichiometryDeviation<5>;
+		case 6: return &StoichiometryDeviation<6>;
+
+		default:
+			ErrorMessages::Switch("StoichiometryDeviation.cpp", "iStoichiometryDeviation", iStoichiometryDeviation);
+			return nullptr;
+	}
 }
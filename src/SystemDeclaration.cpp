@@ -17,4 +17,4 @@
 #include "SystemDeclaration.h"
 
 /// SystemDeclaration
-std::vector<System> sciantix_system;
+thread_local std::vector<System> sciantix_system;
@@ -25,14 +25,15 @@ double TimeStepCalculation( )
 {
   double time_step(0.0);
 
-  // Find the current time interval
+  // Find the current time interval [Time_input[n], Time_input[n+1]), by bisection of the (increasing) input times
   double lower_bound(0.0), upper_bound(0.0);
-  for (int n=0; n<Input_history_points-1; n++)
-    if (Time_h >= Time_input[n] && Time_h < Time_input[n+1])
-    {
-      lower_bound = Time_input[n];
-      upper_bound = Time_input[n+1];
-    }
+  std::vector<double>::const_iterator upper = std::upper_bound(Time_input.begin(), Time_input.begin() + Input_history_points, Time_h);
+  int n = int(upper - Time_input.begin()) - 1;
+  if (n >= 0 && n < Input_history_points - 1)
+  {
+    lower_bound = Time_input[n];
+    upper_bound = Time_input[n+1];
+  }
 
   // Divide the interval in time steps
   time_step = (upper_bound - lower_bound) / Number_of_time_steps_per_interval;
@@ -0,0 +1,82 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "Trace.h"
+#include "Stage.h"
+
+thread_local bool trace_enabled(false);
+
+static thread_local std::ofstream trace_file;
+static thread_local std::chrono::steady_clock::time_point trace_start;
+
+static double TraceTimestamp()
+{
+	/// Time elapsed from the opening of the trace, in microseconds (the time unit of the trace-event format).
+	return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - trace_start).count();
+}
+
+void TraceOpen(std::string file_name)
+{
+	trace_file.open(file_name, std::ios::out);
+	if (!trace_file.is_open())
+	{
+		std::cout << "WARNING - Trace: unable to open " << file_name << ", no trace will be written." << std::endl;
+		return;
+	}
+
+	trace_enabled = true;
+	StageInstrumentationUpdate();
+	trace_start = std::chrono::steady_clock::now();
+
+	trace_file << std::fixed << std::setprecision(3);
+	trace_file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+	trace_file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"SCIANTIX\"}},\n";
+	trace_file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"Sciantix()\"}}";
+}
+
+void TraceBegin(const char* name)
+{
+	if (!trace_enabled) return;
+
+	trace_file << ",\n{\"name\":\"" << name << "\",\"cat\":\"sciantix\",\"ph\":\"B\",\"ts\":" << TraceTimestamp() << ",\"pid\":1,\"tid\":1}";
+}
+
+void TraceEnd(const char* name)
+{
+	if (!trace_enabled) return;
+
+	trace_file << ",\n{\"name\":\"" << name << "\",\"cat\":\"sciantix\",\"ph\":\"E\",\"ts\":" << TraceTimestamp() << ",\"pid\":1,\"tid\":1}";
+}
+
+void TraceCounter(const char* name, double value)
+{
+	/// Counter events are drawn by the viewers as a separate track, named after the counter.
+	/// Non-finite values (nan, inf) are not valid JSON numbers: they are skipped, leaving a gap in the track.
+	if (!trace_enabled || !std::isfinite(value)) return;
+
+	trace_file << ",\n{\"name\":\"" << name << "\",\"ph\":\"C\",\"ts\":" << TraceTimestamp() << ",\"pid\":1,\"args\":{\"value\":"
+		<< std::setprecision(9) << std::scientific << value << std::fixed << std::setprecision(3) << "}}";
+}
+
+void TraceClose()
+{
+	if (!trace_enabled) return;
+
+	trace_file << "\n]}\n";
+	trace_file.close();
+	trace_enabled = false;
+	StageInstrumentationUpdate();
+}
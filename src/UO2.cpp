@@ -29,7 +29,7 @@ void UO2()
 	matrix[index].setName("UO2");
 	matrix[index].setRef("\n\t");
 	matrix[index].setTheoreticalDensity(10970.0); // (kg/m3)
-	matrix[index].setGrainBoundaryMobility(int(input_variable[iv["iGrainGrowth"]].getValue()));
+	(matrix[index].*option_dispatch.grain_boundary_mobility)();
 	matrix[index].setSurfaceTension(0.7); // (N/m)
 	matrix[index].setFFinfluenceRadius(1.0e-9); // (m)
 	matrix[index].setFFrange(6.0e-6); // (m)
@@ -40,5 +40,5 @@ void UO2()
 	matrix[index].setLenticularShapeFactor(0.168610764);
 	matrix[index].setGrainRadius(sciantix_variable[sv["Grain radius"]].getFinalValue()); // (m)
 	matrix[index].setHealingTemperatureThreshold(1273.5); // K
-	matrix[index].setGrainBoundaryVacancyDiffusivity(int(input_variable[iv["iGrainBoundaryVacancyDiffusivity"]].getValue())); // (m2/s)
+	(matrix[index].*option_dispatch.grain_boundary_vacancy_diffusivity)(); // (m2/s)
 }
\ No newline at end of file
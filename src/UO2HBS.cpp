@@ -30,7 +30,7 @@ void UO2HBS()
 	matrix[index].setName("UO2HBS");
 	matrix[index].setRef("\n\t");
 	matrix[index].setTheoreticalDensity(10970.0); // (kg/m3)
-	matrix[index].setGrainBoundaryMobility(0);
+	matrix[index].setGrainBoundaryMobility<0>();
 	matrix[index].setSurfaceTension(0.7); // (N/m)
 	matrix[index].setFFinfluenceRadius(1.0e-9); // (m)
 	matrix[index].setFFrange(6.0e-6); // (m)
@@ -41,5 +41,5 @@ void UO2HBS()
 	matrix[index].setLenticularShapeFactor(0.168610764);
 	matrix[index].setGrainRadius(150e-9); // (m)
 	matrix[index].setHealingTemperatureThreshold(1273.5); // K
-	matrix[index].setGrainBoundaryVacancyDiffusivity(0); // (m2/s)
+	matrix[index].setGrainBoundaryVacancyDiffusivity<0>(); // (m2/s)
 }
\ No newline at end of file
@@ -30,8 +30,6 @@ void UO2Thermochemistry()
    * 
    */
 
-	if (!input_variable[iv["iStoichiometryDeviation"]].getValue()) return;
-
   model.emplace_back();
   int model_index = int(model.size()) - 1;
 
@@ -40,11 +38,11 @@ void UO2Thermochemistry()
   std::string reference;
   reference = "Blackburn (1973) J. Nucl. Mater., 46, 244-252.";
   
-  std::vector<double> parameter;
+  ModelParameter parameter;
 
-  parameter.push_back(sciantix_variable[sv["Stoichiometry deviation"]].getInitialValue());
-  parameter.push_back(history_variable[hv["Temperature"]].getFinalValue()); 
-  parameter.push_back(sciantix_variable[sv["Gap oxygen partial pressure"]].getFinalValue()); // (atm)
+  parameter.uo2_thermochemistry.stoichiometry_deviation = sciantix_variable[sv["Stoichiometry deviation"]].getInitialValue();
+  parameter.uo2_thermochemistry.temperature = history_variable[hv["Temperature"]].getFinalValue();
+  parameter.uo2_thermochemistry.gap_oxygen_partial_pressure = sciantix_variable[sv["Gap oxygen partial pressure"]].getFinalValue(); // (atm)
 
   model[model_index].setParameter(parameter);
   model[model_index].setRef(reference);
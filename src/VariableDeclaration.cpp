@@ -18,5 +18,5 @@
 
 /// InputVariableDeclaration.h
 
-std::vector<InputVariable> input_variable;
+thread_local std::vector<InputVariable> input_variable;
 
@@ -32,10 +32,6 @@ void Xe133_in_UO2()
 	sciantix_system[index].setRadiusInLattice(0.21e-9); // (m), number from experimental results, assumed equal for Xe and Kr
 	sciantix_system[index].setVolumeInLattice(matrix[0].getSchottkyVolume());
 	sciantix_system[index].setHenryConstant(0.0);
-	sciantix_system[index].setProductionRate(1);
-	sciantix_system[index].setFissionGasDiffusivity(int(input_variable[iv["iFGDiffusionCoefficient"]].getValue()));
-	sciantix_system[index].setBubbleDiffusivity(int(input_variable[iv["iBubbleDiffusivity"]].getValue()));
-	sciantix_system[index].setResolutionRate(int(input_variable[iv["iResolutionRate"]].getValue()));
-	sciantix_system[index].setTrappingRate(int(input_variable[iv["iTrappingRate"]].getValue()));
-	sciantix_system[index].setNucleationRate(int(input_variable[iv["iNucleationRate"]].getValue()));
+	sciantix_system[index].setProductionRate<1>();
+	sciantix_system[index].setFissionGasProperties();
 }
@@ -0,0 +1,256 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+/// MMSVerification
+/// Numerical verification of the SCIANTIX solvers via the method of manufactured solutions (MMS), running the real Solver methods
+/// (C++ counterpart of mms_Decay.py, mms_Integrator.py and mms_NewtonBlackburn.py).
+/// Each manufactured problem is solved with decreasing time steps (N, 2N, 4N, ...); for each level the relative error at the final time,
+/// the observed order of convergence and the cost of the integration (work-precision curve) are reported.
+/// SpectralDiffusion is verified both in time (against the exact solution of the same number of modes)
+/// and with respect to the number of modes (against the analytic solution of the diffusion in a sphere).
+/// The direct projection of the initial conditions on the diffusion modes is checked against the iterative one.
+/// The executable returns 1 if an observed order is not the expected one (first-order backward Euler), so it can be run by ctest.
+///
+/// Ref: Oberkampf, W. L., Trucano, T. G., and Hirsch, C. (2004). "Verification, validation, and predictive capability in computational
+/// engineering and physics." ASME. Appl. Mech. Rev. 57(5): 345–384. https://doi.org/10.1115/1.1767847
+
+#include "Solver.h"
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <cmath>
+#include <algorithm>
+
+const double pi = CONSTANT_NUMBERS_H::MathConstants::pi;
+
+static Solver solver;
+
+// Results of the integrations are accumulated in the sink, so that the timed integrations cannot be optimized away
+static volatile double mms_sink(0.0);
+
+/// Time (ns) of an integration, repeated until the measurement lasts at least 2 ms.
+template <typename Integration>
+static double IntegrationCost(Integration integration)
+{
+	unsigned long int repetitions(1);
+	double elapsed(0.0);
+	while (true)
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		for (unsigned long int r = 0; r < repetitions; ++r)
+			mms_sink = mms_sink + integration();
+		elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+		if (elapsed > 2.0e6 || repetitions > (1ul << 30)) break;
+		repetitions *= 2;
+	}
+	return elapsed / repetitions;
+}
+
+/// Runs the integration with N, 2N, ..., 2^(levels-1) N time steps, prints the work-precision table,
+/// and checks the order observed between the two finest levels.
+template <typename Integration>
+static bool Convergence(std::string name, int N, int levels, double exact_solution, Integration integration, double expected_order)
+{
+	std::cout << "\n" << name << std::endl;
+	std::cout << std::setw(10) << "Steps" << std::setw(16) << "Rel. error" << std::setw(10) << "Order" << std::setw(16) << "Cost (ns)" << std::endl;
+
+	double error_previous(0.0), order(0.0);
+	for (int level = 0; level < levels; ++level)
+	{
+		int steps = N << level;
+		double error = std::abs(integration(steps) - exact_solution) / std::abs(exact_solution);
+		double cost = IntegrationCost([&]() { return integration(steps); });
+
+		std::cout << std::setw(10) << steps << std::scientific << std::setprecision(4) << std::setw(16) << error;
+		if (level > 0)
+		{
+			order = std::log2(error_previous / error);
+			std::cout << std::fixed << std::setprecision(3) << std::setw(10) << order;
+		}
+		else
+			std::cout << std::setw(10) << "-";
+		std::cout << std::scientific << std::setprecision(4) << std::setw(16) << cost << std::endl;
+
+		error_previous = error;
+	}
+
+	bool passed = (std::abs(order - expected_order) < 0.2);
+	std::cout << "Observed order = " << std::fixed << std::setprecision(3) << order << " (expected " << expected_order << ") "
+		<< (passed ? "PASSED" : "FAILED") << std::endl;
+	return passed;
+}
+
+// ODE: dx/dt = S - L x, with L = t, S = exp(t) (1 + t) -> x = exp(t)
+static double DecayMMS(int N)
+{
+	const double ti(0.0), tf(1.0), h((tf - ti) / N);
+	double x(1.0);
+	for (int i = 0; i < N; ++i)
+	{
+		double t = ti + (i + 1) * h;
+		x = solver.Decay(x, t, std::exp(t) * (1.0 + t), h);
+	}
+	return x;
+}
+
+// ODE: dx/dt = S, with S = 2t -> x = 1 + t^2
+static double IntegratorMMS(int N)
+{
+	const double ti(0.0), tf(1.0), h((tf - ti) / N);
+	double x(1.0);
+	for (int i = 0; i < N; ++i)
+	{
+		double t = ti + (i + 1) * h;
+		x = solver.Integrator(x, 2.0 * t, h);
+	}
+	return x;
+}
+
+// ODE: dx/dt = k (1 - beta exp(alpha x)), with alpha = ln(P) / sin(t), beta = sin(t), k = cos(t) / (1 - P sin(t)) -> x = sin(t)
+const double newton_langmuir_P(10.0), newton_langmuir_ti(pi / 10.0), newton_langmuir_tf(pi * 9.0 / 10.0);
+static double NewtonLangmuirBasedModelMMS(int N)
+{
+	const double h((newton_langmuir_tf - newton_langmuir_ti) / N);
+	double x(std::sin(newton_langmuir_ti));
+	NewtonLangmuirBasedModelParameter parameter;
+	for (int i = 0; i < N; ++i)
+	{
+		double t = newton_langmuir_ti + (i + 1) * h;
+		parameter.K = std::cos(t) / (1.0 - std::sin(t) * newton_langmuir_P);
+		parameter.beta = std::sin(t);
+		parameter.alpha = std::log(newton_langmuir_P) / std::sin(t);
+		x = solver.NewtonLangmuirBasedModel(x, parameter, h);
+	}
+	return x;
+}
+
+// PDE: dC/dt = D div grad C + S in a sphere of radius a, C(a) = 0, C(0) = 0 -> spatial average of C (Booth, 1957)
+const double diffusion_D(1.0), diffusion_a(1.0), diffusion_S(1.0), diffusion_tf(0.05);
+static int diffusion_modes(40);
+
+static double SpectralDiffusionMMS(int N)
+{
+	const double h(diffusion_tf / N);
+	double modes[1000] = { 0.0 };
+	double x(0.0);
+	const SpectralDiffusionParameter parameter = { double(diffusion_modes), diffusion_D, diffusion_a, diffusion_S, 0.0 };
+	for (int i = 0; i < N; ++i)
+		x = solver.SpectralDiffusion(modes, parameter, h);
+	return x;
+}
+
+static double SpectralDiffusionModesExact(int n_modes, double t)
+{
+	/// Exact time integration of the first n_modes modes used by SpectralDiffusion (no time discretization error).
+	const double projection_coeff = -2.0 * std::sqrt(2.0 / pi);
+	double solution(0.0);
+	for (int n = 1; n <= n_modes; ++n)
+	{
+		const double n_coeff = std::pow(-1.0, n) / n;
+		const double diffusion_rate = pi * pi * diffusion_D * n * n / (diffusion_a * diffusion_a);
+		const double source_rate = projection_coeff * diffusion_S * n_coeff;
+		const double mode = source_rate / diffusion_rate * (1.0 - std::exp(-diffusion_rate * t));
+		solution += projection_coeff * n_coeff * mode / ((4. / 3.) * pi);
+	}
+	return solution;
+}
+
+static double SpectralDiffusionAnalytic(double t)
+{
+	/// Spatial average of the concentration, C = S a^2 / (15 D) [1 - 90 / pi^4 sum 1/n^4 exp(-n^2 pi^2 D t / a^2)]
+	double series(0.0);
+	for (double n = 100000.0; n >= 1.0; n -= 1.0)
+		series += std::exp(-n * n * pi * pi * diffusion_D * t / (diffusion_a * diffusion_a)) / std::pow(n, 4);
+	return diffusion_S * diffusion_a * diffusion_a / (15.0 * diffusion_D) * (1.0 - 90.0 / std::pow(pi, 4) * series);
+}
+
+static bool SpectralDiffusionModes()
+{
+	/// Truncation error of the spectral expansion with the number of modes (modes integrated exactly in time),
+	/// and cost of a SpectralDiffusion time step with the same number of modes.
+	std::cout << "\nSpectralDiffusion - number of modes (t = " << diffusion_tf << ")" << std::endl;
+	std::cout << std::setw(10) << "Modes" << std::setw(16) << "Rel. error" << std::setw(10) << "Order" << std::setw(16) << "Cost/step (ns)" << std::endl;
+
+	const double analytic = SpectralDiffusionAnalytic(diffusion_tf);
+	const int steps(100);
+	double error_previous(0.0);
+	bool passed(true);
+
+	for (int n_modes = 5; n_modes <= 160; n_modes *= 2)
+	{
+		diffusion_modes = n_modes;
+		double time_error = std::abs(SpectralDiffusionModesExact(n_modes, diffusion_tf) - analytic) / analytic;
+		double cost = IntegrationCost([&]() { return SpectralDiffusionMMS(steps); }) / steps;
+
+		std::cout << std::setw(10) << n_modes << std::scientific << std::setprecision(4) << std::setw(16) << time_error;
+		if (n_modes > 5)
+		{
+			std::cout << std::fixed << std::setprecision(3) << std::setw(10) << std::log2(error_previous / time_error);
+			if (!(time_error < error_previous)) passed = false;
+		}
+		else
+			std::cout << std::setw(10) << "-";
+		std::cout << std::scientific << std::setprecision(4) << std::setw(16) << cost << std::endl;
+
+		error_previous = time_error;
+	}
+	diffusion_modes = 40;
+
+	std::cout << "Error decreasing with the number of modes: " << (passed ? "PASSED" : "FAILED") << std::endl;
+	return passed;
+}
+
+static void NewtonBlackburnAccuracy()
+{
+	/// Manufactured root of the Blackburn equation: given x and T, the oxygen partial pressure is computed from the equation,
+	/// and the solver is started from the stoichiometry deviation of the previous time step (x - dx).
+	std::cout << "\nNewtonBlackburn - manufactured root (T = 1473 K, initial guess x - 0.01)" << std::endl;
+	std::cout << std::setw(10) << "x" << std::setw(16) << "Rel. error" << std::setw(14) << "Iterations" << std::endl;
+
+	const double temperature(1473.0);
+	for (double x = 0.02; x < 0.25; x += 0.04)
+	{
+		double log_pressure = 2.0 * std::log(x * (x + 2.0) / (1.0 - x)) + 108.0 * std::pow(x, 2.0) - 32700.0 / temperature + 9.92;
+		const NewtonBlackburnParameter parameter = { x - 0.01, temperature, std::exp(log_pressure) };
+
+		unsigned long int iterations = solver.newton_iterations;
+		double root = solver.NewtonBlackburn(parameter);
+
+		std::cout << std::fixed << std::setprecision(3) << std::setw(10) << x << std::scientific << std::setprecision(4) << std::setw(16)
+			<< std::abs(root - x) / x << std::setw(14) << solver.newton_iterations - iterations << std::endl;
+	}
+}
+
+int main()
+{
+	std::cout << "SCIANTIX - verification of the solvers via the method of manufactured solutions" << std::endl;
+
+	bool passed(true);
+
+	passed &= Convergence("Decay - dx/dt = S - L x, x = exp(t)", 20, 7, std::exp(1.0), DecayMMS, 1.0);
+	passed &= Convergence("Integrator - dx/dt = S, x = 1 + t^2", 20, 7, 2.0, IntegratorMMS, 1.0);
+	passed &= Convergence("NewtonLangmuirBasedModel - dx/dt = k (1 - beta exp(alpha x)), x = sin(t)", 100, 7, std::sin(newton_langmuir_tf), NewtonLangmuirBasedModelMMS, 1.0);
+	passed &= Convergence("SpectralDiffusion - time steps (40 modes)", 10, 7, SpectralDiffusionModesExact(40, diffusion_tf), SpectralDiffusionMMS, 1.0);
+	passed &= SpectralDiffusionModes();
+
+	NewtonBlackburnAccuracy();
+
+	std::cout << "\nMMS verification " << (passed ? "PASSED" : "FAILED") << std::endl;
+
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,227 @@
+"""
+This script generates synthetic input_history.txt files, with any number of time points,
+to test how SCIANTIX scales with the length of the irradiation history and with the number of time steps.
+
+The histories are built by concatenating realistic segments:
+- base irradiation: reactor cycles at nominal power (with slow power fluctuations), followed by outages;
+- load following: daily power cycles (100% -> ~50% -> 100%);
+- ramp test: conditioning at reduced power, power ramp to a terminal power above nominal, holding, scram;
+- LOCA-like transient: scram, fast heat-up of the fuel to 1100-1400 K, holding, quench;
+- steam exposure: out-of-pile annealing in steam, for the fuel oxidation models (iStoichiometryDeviation > 0).
+
+The history is generated with a fixed random seed, so that the same command always gives the same file.
+Remember that SCIANTIX divides each interval of the input history in a fixed number of time steps (100),
+so a history of N points results in about 100 N time steps.
+
+Usage examples:
+  python3 syntheticHistory.py --scenario mixed --points 1000000 --output long_history
+  python3 syntheticHistory.py --scenario steam --points 5000 --case ../../regression/test_UO2_oxidation_Cox_et_al_data_1473K --output steam_history
+
+Columns: time (h), temperature (K), fission rate (fiss / m3 s), hydrostatic stress (MPa), [steam pressure (atm)]
+
+"""
+
+import os
+import sys
+import shutil
+import random
+import argparse
+
+# Reference operating conditions
+# ------------------------------
+fission_rate_nominal = 1.0e19   # (fiss / m3 s)
+temperature_coolant = 580.0     # (K)
+temperature_pool = 300.0        # (K)
+temperature_nominal = 1300.0    # (K)
+stress_nominal = -0.2           # (MPa)
+steam_pressure_nominal = 1.0    # (atm)
+
+# Shortest interval of the history (h), to keep the time strictly increasing
+dt_min = 1.0e-4
+
+def operatingPoint(power, temperature_full_power, steam_pressure=0.0):
+  """
+  Temperature, fission rate and hydrostatic stress of the fuel at the given power fraction.
+  Above nominal power (ramp tests), the pellet-cladding interaction increases the compressive stress.
+  """
+  temperature = temperature_coolant + (temperature_full_power - temperature_coolant) * power
+  fission_rate = fission_rate_nominal * power
+  stress = stress_nominal - 15.0 * max(0.0, power - 1.0)
+  return (temperature, fission_rate, stress, steam_pressure)
+
+def baseIrradiation(rng):
+  """
+  One reactor cycle (about one year at nominal power, with slow power fluctuations) followed by the outage.
+  """
+  points = []
+  temperature_full_power = temperature_nominal + rng.uniform(-150.0, 150.0)
+
+  points.append((24.0, ) + operatingPoint(1.0, temperature_full_power))
+  cycle_length = rng.uniform(7000.0, 9000.0)
+  time = 0.0
+  while time < cycle_length:
+    dt = rng.uniform(120.0, 360.0)
+    time += dt
+    points.append((dt, ) + operatingPoint(rng.uniform(0.9, 1.05), temperature_full_power))
+
+  points.append((6.0, ) + operatingPoint(0.0, temperature_full_power))
+  points.append((1.0, temperature_pool, 0.0, stress_nominal, 0.0))
+  points.append((rng.uniform(500.0, 1000.0), temperature_pool, 0.0, stress_nominal, 0.0))
+  points.append((12.0, ) + operatingPoint(0.0, temperature_full_power))
+  return points
+
+def loadFollowing(rng, days=30):
+  """
+  Daily power cycles: holding at nominal power, power reduction in two hours, holding at reduced power, power recovery.
+  """
+  points = []
+  temperature_full_power = temperature_nominal + rng.uniform(-100.0, 100.0)
+
+  points.append((24.0, ) + operatingPoint(1.0, temperature_full_power))
+  for day in range(days):
+    reduced_power = rng.uniform(0.4, 0.6)
+    hold_reduced = rng.uniform(4.0, 8.0)
+    points.append((24.0 - 4.0 - hold_reduced, ) + operatingPoint(1.0, temperature_full_power))
+    points.append((2.0, ) + operatingPoint(reduced_power, temperature_full_power))
+    points.append((hold_reduced, ) + operatingPoint(reduced_power, temperature_full_power))
+    points.append((2.0, ) + operatingPoint(1.0, temperature_full_power))
+  return points
+
+def rampTest(rng):
+  """
+  Power ramp test: conditioning at reduced power, ramp to the terminal power, holding, scram.
+  """
+  points = []
+  temperature_full_power = temperature_nominal + rng.uniform(-100.0, 100.0)
+  terminal_power = rng.uniform(1.3, 1.6)
+
+  points.append((2.0, ) + operatingPoint(0.6, temperature_full_power))
+  points.append((24.0, ) + operatingPoint(0.6, temperature_full_power))
+  points.append((rng.uniform(0.2, 1.0), ) + operatingPoint(terminal_power, temperature_full_power))
+  points.append((rng.uniform(1.0, 24.0), ) + operatingPoint(terminal_power, temperature_full_power))
+  points.append((0.01, ) + operatingPoint(0.0, temperature_full_power))
+  points.append((1.0, temperature_pool, 0.0, stress_nominal, 0.0))
+  return points
+
+def locaTransient(rng, steam=False):
+  """
+  LOCA-like transient from nominal power: scram, loss of the coolant pressure, heat-up of the fuel,
+  holding at high temperature (in steam, if requested), quench.
+  """
+  points = []
+  steam_pressure = steam_pressure_nominal if steam else 0.0
+  peak_temperature = rng.uniform(1100.0, 1400.0)
+
+  points.append((24.0, ) + operatingPoint(1.0, temperature_nominal))
+  points.append((0.001, temperature_nominal, 0.0, 0.0, steam_pressure))
+  points.append((rng.uniform(0.01, 0.03), peak_temperature, 0.0, 0.0, steam_pressure))
+  points.append((rng.uniform(0.05, 0.3), peak_temperature, 0.0, 0.0, steam_pressure))
+  points.append((0.05, 400.0, 0.0, 0.0, 0.0))
+  points.append((1.0, temperature_pool, 0.0, 0.0, 0.0))
+  return points
+
+def steamExposure(rng):
+  """
+  Out-of-pile annealing in steam (as in the oxidation experiments of the regression database).
+  """
+  points = []
+  temperature = rng.uniform(1273.0, 1473.0)
+
+  points.append((0.1, temperature, 0.0, 0.0, steam_pressure_nominal))
+  points.append((rng.uniform(2.0, 50.0), temperature, 0.0, 0.0, steam_pressure_nominal))
+  points.append((0.1, temperature_pool, 0.0, 0.0, 0.0))
+  return points
+
+def scenarioSegments(scenario, rng, steam):
+  """
+  Segments of one repetition of the scenario.
+  """
+  if scenario == 'base':
+    return baseIrradiation(rng)
+  elif scenario == 'load-following':
+    return loadFollowing(rng)
+  elif scenario == 'ramp':
+    return baseIrradiation(rng) + rampTest(rng)
+  elif scenario == 'loca':
+    return baseIrradiation(rng) + locaTransient(rng, steam)
+  elif scenario == 'steam':
+    return steamExposure(rng)
+  elif scenario == 'mixed':
+    return baseIrradiation(rng) + loadFollowing(rng) + rampTest(rng) + locaTransient(rng, steam) + (steamExposure(rng) if steam else [])
+
+def generateHistory(scenario, points_number, seed, steam):
+  """
+  Concatenates repetitions of the scenario until the requested number of points is reached.
+  """
+  rng = random.Random(seed)
+
+  if scenario == 'steam':
+    history = [(0.0, temperature_pool, 0.0, 0.0, 0.0)]
+  else:
+    history = [(0.0, temperature_pool, 0.0, stress_nominal, 0.0)]
+
+  time = 0.0
+  while len(history) < points_number:
+    for (dt, temperature, fission_rate, stress, steam_pressure) in scenarioSegments(scenario, rng, steam):
+      time += max(dt, dt_min)
+      history.append((time, temperature, fission_rate, stress, steam_pressure))
+      if len(history) == points_number:
+        break
+
+  return history
+
+def writeHistory(file_name, history, steam):
+  """
+  Writes the input_history.txt file (without a final newline, as in the regression database).
+  """
+  with open(file_name, 'w') as file:
+    lines = []
+    for (time, temperature, fission_rate, stress, steam_pressure) in history:
+      line = f"{time:.6f}\t{temperature:.3f}\t{fission_rate:.6e}\t{stress:.4f}"
+      if steam:
+        line += f"\t{steam_pressure:.6f}"
+      lines.append(line)
+    file.write("\n".join(lines))
+
+def stoichiometryDeviationOption(settings_file):
+  """
+  Value of iStoichiometryDeviation in the input_settings.txt file (0 if not found).
+  """
+  with open(settings_file, 'r') as file:
+    for line in file:
+      if 'iStoichiometryDeviation' in line:
+        return int(line.split()[0])
+  return 0
+
+if __name__ == "__main__":
+
+  parser = argparse.ArgumentParser(description="Generator of synthetic SCIANTIX input histories.")
+  parser.add_argument('--scenario', choices=['base', 'load-following', 'ramp', 'loca', 'steam', 'mixed'], default='mixed')
+  parser.add_argument('--points', type=int, default=10000, help="number of time points of the history")
+  parser.add_argument('--seed', type=int, default=1, help="seed of the random generator")
+  parser.add_argument('--steam', action='store_true', help="write the steam pressure column (always written for the steam scenario)")
+  parser.add_argument('--case', default=None, help="folder of a case (e.g., a regression test) whose other input files are copied with the history")
+  parser.add_argument('--output', default='.', help="output folder")
+  args = parser.parse_args()
+
+  steam = args.steam or args.scenario == 'steam'
+
+  if args.points < 2:
+    sys.exit("The input history needs at least two points.")
+
+  os.makedirs(args.output, exist_ok=True)
+
+  if args.case is not None:
+    for file_name in ['input_settings.txt', 'input_initial_conditions.txt', 'input_scaling_factors.txt']:
+      if os.path.exists(os.path.join(args.case, file_name)):
+        shutil.copy(os.path.join(args.case, file_name), os.path.join(args.output, file_name))
+
+    settings_file = os.path.join(args.output, 'input_settings.txt')
+    if os.path.exists(settings_file) and (stoichiometryDeviationOption(settings_file) > 0) != steam:
+      print("WARNING: the steam pressure column is read by SCIANTIX only with iStoichiometryDeviation > 0 in input_settings.txt,"
+            " use --steam (or the steam scenario) with the oxidation cases only.")
+
+  history = generateHistory(args.scenario, args.points, args.seed, steam)
+  writeHistory(os.path.join(args.output, 'input_history.txt'), history, steam)
+
+  print(f"Written {len(history)} points ({history[-1][0]:.1f} h) in {os.path.join(args.output, 'input_history.txt')}")
@@ -0,0 +1,65 @@
+# Runs a case of the regression database writing a checkpoint every INTERVAL time steps (--checkpoint-interval),
+# then resumes it (--resume), in a new directory, from the checkpoint written halfway through the input history:
+# the test fails if the output of the resumed simulation is not the same, bit for bit, as the tail of the output
+# of the uninterrupted simulation.
+#
+# Usage: cmake -DSCIANTIX=<sciantix> -DCASE=<regression case directory> -DINTERVAL=<n> -DWORK=<working directory> -P CheckpointResume.cmake
+
+get_filename_component(name ${CASE} NAME)
+file(REMOVE_RECURSE ${WORK}/${name})
+file(GLOB inputs ${CASE}/input_*)
+file(COPY ${inputs} DESTINATION ${WORK}/${name}/full)
+file(COPY ${inputs} DESTINATION ${WORK}/${name}/resumed)
+
+execute_process(COMMAND ${SCIANTIX} --checkpoint-interval ${INTERVAL}
+    WORKING_DIRECTORY ${WORK}/${name}/full
+    RESULT_VARIABLE result
+    OUTPUT_QUIET
+    ERROR_VARIABLE error)
+
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${name} (full): ${error}")
+endif()
+
+# Time steps of the periodic checkpoints (checkpoint_<step>.bin), the one halfway through is resumed
+file(GLOB checkpoints RELATIVE ${WORK}/${name}/full ${WORK}/${name}/full/checkpoint_*.bin)
+set(steps "")
+foreach(checkpoint ${checkpoints})
+    string(REGEX REPLACE "^checkpoint_([0-9]+)\\.bin$" "\\1" step ${checkpoint})
+    list(APPEND steps ${step})
+endforeach()
+
+list(LENGTH steps count)
+if(count EQUAL 0)
+    message(FATAL_ERROR "${name}: no checkpoint written every ${INTERVAL} time steps")
+endif()
+
+list(SORT steps COMPARE NATURAL)
+math(EXPR middle "${count} / 2")
+list(GET steps ${middle} step)
+
+execute_process(COMMAND ${SCIANTIX} --resume ${WORK}/${name}/full/checkpoint_${step}.bin
+    WORKING_DIRECTORY ${WORK}/${name}/resumed
+    RESULT_VARIABLE result
+    OUTPUT_QUIET
+    ERROR_VARIABLE error)
+
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${name} (resumed from time step ${step}): ${error}")
+endif()
+
+file(READ ${WORK}/${name}/full/output.txt full)
+file(READ ${WORK}/${name}/resumed/output.txt resumed)
+string(LENGTH "${full}" full_length)
+string(LENGTH "${resumed}" resumed_length)
+
+if(resumed_length EQUAL 0 OR resumed_length GREATER full_length)
+    message(FATAL_ERROR "${name}: the resumed simulation (from time step ${step}) does not continue the uninterrupted one")
+endif()
+
+math(EXPR tail_begin "${full_length} - ${resumed_length}")
+string(SUBSTRING "${full}" ${tail_begin} -1 tail)
+
+if(NOT tail STREQUAL resumed)
+    message(FATAL_ERROR "${name}: the output resumed from time step ${step} differs from the uninterrupted simulation")
+endif()
@@ -0,0 +1,98 @@
+# Runs an ensemble of branches (--ensemble) forked from the checkpoint of a base irradiation, and each branch again, on its own,
+# as a simulation resumed from the same checkpoint (--resume): the test fails if the output.txt of a branch is not the same,
+# bit for bit, as the output of the base irradiation followed by the output of the sequential resumed simulation.
+# One of the branches has an empty input history: the test also fails if that error stops the other branches, or if the
+# ensemble does not fail writing the error_log.txt of that branch.
+# A second ensemble runs on one thread a branch interrupted by an error after some time steps (its interval checkpoint cannot
+# be written), followed by a copy of the constant branch: the test fails if the state left by the interrupted branch changes
+# the output of the following one.
+#
+# Usage: cmake -DSCIANTIX=<sciantix> -DCASE=<regression case directory> -DWORK=<working directory> -P Ensemble.cmake
+
+set(work ${WORK}/ensemble)
+file(REMOVE_RECURSE ${work})
+file(GLOB inputs ${CASE}/input_initial_conditions.txt ${CASE}/input_settings.txt ${CASE}/input_scaling_factors.txt)
+file(COPY ${inputs} DESTINATION ${work})
+
+# Base irradiation, and the branches continuing it: a constant temperature and a temperature transient
+file(WRITE ${work}/input_history.txt "0\t1273\t1e19\t0\n1000\t1273\t1e19\t0\n")
+file(WRITE ${work}/constant/input_history.txt "0\t1273\t1e19\t0\n1000\t1273\t1e19\t0\n2000\t1273\t1e19\t0\n")
+file(WRITE ${work}/transient/input_history.txt "0\t1273\t1e19\t0\n1000\t1273\t1e19\t0\n1001\t1873\t0\t0\n1100\t1873\t0\t0\n")
+file(WRITE ${work}/empty/input_history.txt "")
+file(WRITE ${work}/ensemble.txt "constant\ntransient\nempty\n")
+set(branches constant transient)
+
+execute_process(COMMAND ${SCIANTIX} --checkpoint base.bin
+    WORKING_DIRECTORY ${work}
+    RESULT_VARIABLE result
+    OUTPUT_QUIET
+    ERROR_VARIABLE error)
+
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "base irradiation: ${error}")
+endif()
+
+execute_process(COMMAND ${SCIANTIX} --resume base.bin --ensemble ensemble.txt --ensemble-threads 3
+    WORKING_DIRECTORY ${work}
+    RESULT_VARIABLE result
+    OUTPUT_QUIET
+    ERROR_QUIET)
+
+if(EXISTS ${work}/error_log.txt)
+    file(READ ${work}/error_log.txt ensemble_error)
+endif()
+
+if(result EQUAL 0 OR NOT EXISTS ${work}/empty/error_log.txt OR NOT ensemble_error MATCHES "empty/")
+    message(FATAL_ERROR "the ensemble does not report the error of the branch with an empty input history")
+endif()
+
+file(READ ${work}/output.txt base_output)
+
+foreach(branch ${branches})
+    if(EXISTS ${work}/${branch}/error_log.txt)
+        message(FATAL_ERROR "${branch}: the branch failed")
+    endif()
+
+    file(COPY ${inputs} ${work}/${branch}/input_history.txt DESTINATION ${work}/sequential_${branch})
+
+    execute_process(COMMAND ${SCIANTIX} --resume ${work}/base.bin
+        WORKING_DIRECTORY ${work}/sequential_${branch}
+        RESULT_VARIABLE result
+        OUTPUT_QUIET
+        ERROR_VARIABLE error)
+
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "${branch} (sequential): ${error}")
+    endif()
+
+    file(READ ${work}/${branch}/output.txt branch_output)
+    file(READ ${work}/sequential_${branch}/output.txt sequential_output)
+
+    if(NOT branch_output STREQUAL "${base_output}${sequential_output}")
+        message(FATAL_ERROR "${branch}: the output of the branch differs from the sequential resumed simulation")
+    endif()
+endforeach()
+
+# Interrupted branch followed by a good branch on the same thread
+file(WRITE ${work}/interrupted/input_history.txt "0\t1273\t1e19\t0\n1000\t1273\t1e19\t0\n2000\t1273\t1e19\t0\n")
+file(COPY ${work}/constant/input_history.txt DESTINATION ${work}/after_interrupted)
+file(MAKE_DIRECTORY ${work}/after_interrupted/checkpoints)
+file(WRITE ${work}/serial.txt "interrupted\nafter_interrupted\n")
+
+execute_process(COMMAND ${SCIANTIX} --resume base.bin --ensemble serial.txt --ensemble-threads 1
+        --checkpoint checkpoints/branch.bin --checkpoint-interval 10
+    WORKING_DIRECTORY ${work}
+    RESULT_VARIABLE result
+    OUTPUT_QUIET
+    ERROR_QUIET)
+
+if(result EQUAL 0 OR NOT EXISTS ${work}/interrupted/error_log.txt OR EXISTS ${work}/after_interrupted/error_log.txt)
+    message(FATAL_ERROR "the ensemble does not report the error of the interrupted branch only")
+endif()
+
+file(READ ${work}/after_interrupted/output.txt branch_output)
+file(READ ${work}/sequential_constant/output.txt sequential_output)
+
+if(NOT branch_output STREQUAL "${base_output}${sequential_output}")
+    message(FATAL_ERROR "after_interrupted: the output of the branch differs from the sequential resumed simulation")
+endif()
@@ -0,0 +1,42 @@
+# Runs the cases of the regression database matching a pattern with the specialised sequence of the models
+# (ModelSpecialisation) and with the generic sequence (--generic-models): the test fails if the output.txt
+# of the two runs is not the same, bit for bit.
+#
+# Usage: cmake -DSCIANTIX=<sciantix> -DREGRESSION=<regression directory> -DPATTERN=<case pattern> -DWORK=<working directory> -P GenericModels.cmake
+
+file(GLOB cases LIST_DIRECTORIES true ${REGRESSION}/${PATTERN})
+
+foreach(case ${cases})
+    if(IS_DIRECTORY ${case})
+        get_filename_component(name ${case} NAME)
+        file(GLOB inputs ${case}/input_*)
+
+        foreach(sequence specialised generic)
+            file(REMOVE_RECURSE ${WORK}/${name}/${sequence})
+            file(COPY ${inputs} DESTINATION ${WORK}/${name}/${sequence})
+
+            if(sequence STREQUAL generic)
+                set(arguments --generic-models)
+            else()
+                set(arguments "")
+            endif()
+
+            execute_process(COMMAND ${SCIANTIX} ${arguments}
+                WORKING_DIRECTORY ${WORK}/${name}/${sequence}
+                RESULT_VARIABLE result
+                OUTPUT_QUIET
+                ERROR_VARIABLE error)
+
+            if(NOT result EQUAL 0)
+                message(FATAL_ERROR "${name} (${sequence}): ${error}")
+            endif()
+        endforeach()
+
+        file(READ ${WORK}/${name}/specialised/output.txt specialised_output)
+        file(READ ${WORK}/${name}/generic/output.txt generic_output)
+
+        if(NOT specialised_output STREQUAL generic_output)
+            message(FATAL_ERROR "${name}: the output of the specialised models differs from the generic sequence")
+        endif()
+    endif()
+endforeach()
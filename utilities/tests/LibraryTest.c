@@ -0,0 +1,105 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+/// LibraryTest
+/// Test of the C interface of libsciantix (include/SciantixLibrary.h), compiled as C and linked against the static and the shared library.
+/// A context with the default input settings and initial conditions is advanced as the regression case test_Baker1977__1273K
+/// (1273 K, 1e19 fiss / m3 s, 100 time steps of 55 h): the xenon produced and in grain after 5500 h are compared with output_gold.txt.
+/// Wrong input settings and arguments must return -1 without changing the context, and the library must not write any file
+/// (output.txt, error_log.txt) in the working directory.
+/// The executable returns 1 if a check fails, so it can be run by ctest.
+
+#include "SciantixLibrary.h"
+#include <stdio.h>
+#include <math.h>
+
+static int failures = 0;
+
+static void Check(int condition, const char* description)
+{
+	printf("%s: %s\n", description, condition ? "PASSED" : "FAILED");
+	if (!condition) ++failures;
+}
+
+static int FileExists(const char* file_name)
+{
+	FILE* file = fopen(file_name, "r");
+	if (file == NULL) return 0;
+	fclose(file);
+	return 1;
+}
+
+static int Close(double value, double reference)
+{
+	/* output_gold.txt holds 7 significant digits */
+	return fabs(value - reference) <= 1.0e-6 * fabs(reference);
+}
+
+int main(void)
+{
+	int options[SCIANTIX_OPTIONS];
+	int i;
+	int status = 0;
+	int xe_produced, xe_in_grain;
+	sciantix_context* context;
+
+	printf("SCIANTIX - test of the C interface of libsciantix\n");
+
+	remove("output.txt");
+	remove("error_log.txt");
+
+	context = sciantix_create();
+	Check(context != NULL, "Context with the default input settings");
+	if (context == NULL) return 1;
+
+	/* Wrong input settings and arguments */
+	for (i = 0; i < SCIANTIX_OPTIONS; ++i) options[i] = 0;
+	options[2] = 3;
+	Check(sciantix_set_options(context, options, SCIANTIX_OPTIONS) == -1, "iDiffusionSolver = 3 is rejected");
+	options[2] = 1;
+	options[0] = 99;
+	Check(sciantix_set_options(context, options, SCIANTIX_OPTIONS) == -1, "iGrainGrowth = 99 is rejected");
+	options[0] = 1;
+	options[30] = 1;
+	Check(sciantix_set_options(context, options, SCIANTIX_OPTIONS) == -1, "An input setting not read by SCIANTIX must be 0");
+	options[30] = 0;
+	Check(sciantix_set_options(context, options, SCIANTIX_OPTIONS + 1) == -1, "Too many input settings are rejected");
+	Check(sciantix_set_options(NULL, options, 1) == -1, "A NULL context is rejected");
+	Check(sciantix_advance(context, -1.0, 1273.0, 1.0e19, 0.0, 0.0) == -1, "A negative time step is rejected");
+	Check(sciantix_variable_handle(context, "No such variable") == -1, "An unknown variable has no handle");
+
+	/* The rejected input settings left the default ones: the context runs as test_Baker1977__1273K */
+	xe_produced = sciantix_variable_handle(context, "Xe produced");
+	xe_in_grain = sciantix_variable_handle(context, "Xe in grain");
+	Check(xe_produced >= 0 && xe_in_grain >= 0, "Handles of Xe produced and Xe in grain");
+
+	/* As in SimulationTimeStep, the first time step (at the first time of the input history) has zero size */
+	status = sciantix_advance(context, 0.0, 1273.0, 1.0e19, 0.0, 0.0);
+	for (i = 0; i < 100 && status == 0; ++i)
+		status = sciantix_advance(context, 55.0 * 3600.0, 1273.0, 1.0e19, 0.0, 0.0);
+
+	Check(status == 0 && sciantix_get_time_step_number(context) == 101, "100 time steps after the initial one");
+	Check(Close(sciantix_get_variable(context, xe_produced), 4.752e+25), "Xe produced after 5500 h (output_gold.txt)");
+	Check(Close(sciantix_get_variable(context, xe_in_grain), 3.194756e+25), "Xe in grain after 5500 h (output_gold.txt)");
+
+	Check(!FileExists("output.txt") && !FileExists("error_log.txt"), "No files written");
+
+	sciantix_destroy(context);
+
+	printf("\nLibrary test %s\n", failures == 0 ? "PASSED" : "FAILED");
+
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,26 @@
+# Runs the check build sciantix_schedule_check (see include/ScheduleCheck.h) on every case of the regression database,
+# with the generic sequence of the models (--generic-models): the test fails if a scheduled model reads or writes
+# a variable that it does not declare in ModelRegistry.
+#
+# Usage: cmake -DSCIANTIX=<sciantix_schedule_check> -DREGRESSION=<regression directory> -DWORK=<working directory> -P ScheduleCheck.cmake
+
+file(GLOB cases LIST_DIRECTORIES true ${REGRESSION}/test_*)
+
+foreach(case ${cases})
+    if(IS_DIRECTORY ${case})
+        get_filename_component(name ${case} NAME)
+        file(REMOVE_RECURSE ${WORK}/${name})
+        file(GLOB inputs ${case}/input_*)
+        file(COPY ${inputs} DESTINATION ${WORK}/${name})
+
+        execute_process(COMMAND ${SCIANTIX} --generic-models
+            WORKING_DIRECTORY ${WORK}/${name}
+            RESULT_VARIABLE result
+            OUTPUT_QUIET
+            ERROR_VARIABLE error)
+
+        if(NOT result EQUAL 0)
+            message(FATAL_ERROR "${name}: ${error}")
+        endif()
+    endif()
+endforeach()
@@ -0,0 +1,152 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+/// StateBufferTest
+/// Test of SciantixStateBuffer: each case of the regression database given in the command line is run once as a plain simulation
+/// (SimulationStepper), and once calling Sciantix through the committed/trial buffers with the same input history. At each time step
+/// a trial with a perturbed history (temperature and fission rate) is computed and discarded (rollback), then the trial with the history
+/// of the plain simulation is computed and accepted (commit). The test checks, bit for bit, that
+/// - the discarded trial leaves the committed state unchanged,
+/// - the accepted trial and the committed state after the commit are the state of the plain simulation (variables 0-69 and diffusion modes),
+/// - the plain simulation does not touch the elements of Sciantix_variables after the exchanged ones (70-299).
+/// The input files of each case are copied in <work directory>/<case>, where the files of the simulation are written.
+/// The executable returns 1 if a case fails, so it can be run by ctest.
+///
+/// Usage: sciantix_state_buffer_test <work directory> <case directory> [<case directory> ...]
+
+#include "SimulationStepper.h"
+#include "SciantixStateBuffer.h"
+#include <filesystem>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <algorithm>
+
+/// State after a time step of the plain simulation, and the history it was computed with
+struct StepRecord
+{
+	double history[20];
+	double variables[70];
+	double diffusion_modes[1000];
+};
+
+static bool SameState(const double* variables, const double* diffusion_modes, const StepRecord& record)
+{
+	return std::memcmp(variables, record.variables, sizeof(record.variables)) == 0
+		&& std::memcmp(diffusion_modes, record.diffusion_modes, sizeof(record.diffusion_modes)) == 0;
+}
+
+static StepRecord Record(const double* history)
+{
+	StepRecord record;
+	std::copy(history, history + 20, record.history);
+	std::copy(Sciantix_variables, Sciantix_variables + 70, record.variables);
+	std::copy(Sciantix_diffusion_modes, Sciantix_diffusion_modes + 1000, record.diffusion_modes);
+	return record;
+}
+
+static bool StateBufferCase(const std::string& case_directory, const std::string& work_directory)
+{
+	const std::string name = std::filesystem::path(case_directory).filename().string();
+	const std::filesystem::path directory = std::filesystem::path(work_directory) / name;
+	std::filesystem::remove_all(directory);
+	std::filesystem::create_directories(directory);
+	for (const std::filesystem::directory_entry& file : std::filesystem::directory_iterator(case_directory))
+		if (file.path().filename().string().rfind("input_", 0) == 0)
+			std::filesystem::copy_file(file.path(), directory / file.path().filename());
+
+	Simulation_directory = directory.string() + "/";
+
+	// Plain simulation: the history of each time step is the one passed to Sciantix, with the time step size of that call
+	StepRecord initial;
+	std::vector<StepRecord> steps;
+	bool untouched(true);
+	{
+		SimulationStepper simulation;
+		initial = Record(Sciantix_history);
+		std::fill(Sciantix_variables + 70, Sciantix_variables + 300, -1.0);
+
+		double step_size = Sciantix_history[6];
+		while (simulation.step())
+		{
+			steps.push_back(Record(Sciantix_history));
+			steps.back().history[6] = step_size;
+			step_size = Sciantix_history[6];
+		}
+
+		for (int i = 70; i < 300; ++i)
+			untouched &= (Sciantix_variables[i] == -1.0);
+	}
+
+	// The same simulation through the committed/trial buffers, from the same initial state
+	SimulationStepper simulation;
+	SciantixStateBuffer buffer(Sciantix_variables, Sciantix_diffusion_modes);
+
+	std::vector<StepRecord>::size_type failed_step(steps.size());
+	for (std::vector<StepRecord>::size_type s = 0; s < steps.size() && failed_step == steps.size(); ++s)
+	{
+		const StepRecord& start = (s == 0) ? initial : steps[s - 1];
+
+		double history[20];
+		std::copy(steps[s].history, steps[s].history + 20, history);
+		history[1] += 100.0;
+		history[3] *= 2.0;
+
+		buffer.trial(Sciantix_options, history, Sciantix_scaling_factors);
+		if (!SameState(buffer.getCommittedVariables(), buffer.getCommittedDiffusionModes(), start))
+			failed_step = s;
+
+		std::copy(steps[s].history, steps[s].history + 20, history);
+		buffer.trial(Sciantix_options, history, Sciantix_scaling_factors);
+		if (!SameState(buffer.getTrialVariables(), buffer.getTrialDiffusionModes(), steps[s]))
+			failed_step = s;
+
+		buffer.commit();
+		if (!SameState(buffer.getCommittedVariables(), buffer.getCommittedDiffusionModes(), steps[s]))
+			failed_step = s;
+	}
+
+	const bool passed = (failed_step == steps.size()) && !steps.empty() && untouched;
+	std::cout << name << " (" << steps.size() << " time steps): ";
+	if (passed) std::cout << "PASSED" << std::endl;
+	else if (!untouched) std::cout << "FAILED, the elements 70-299 of Sciantix_variables were written" << std::endl;
+	else std::cout << "FAILED at time step " << failed_step << std::endl;
+
+	return passed;
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 3)
+	{
+		std::cerr << "Usage: sciantix_state_buffer_test <work directory> <case directory> [<case directory> ...]" << std::endl;
+		return 1;
+	}
+
+	std::cout << "SCIANTIX - test of the committed/trial state buffer" << std::endl;
+
+	// The output files of the simulations are not needed
+	Output_txt = false;
+
+	bool passed(true);
+	for (int i = 2; i < argc; ++i)
+		passed &= StateBufferCase(argv[i], argv[1]);
+
+	std::cout << "\nState buffer test " << (passed ? "PASSED" : "FAILED") << std::endl;
+
+	return passed ? 0 : 1;
+}
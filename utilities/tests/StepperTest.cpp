@@ -0,0 +1,100 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//       _______.  ______  __       ___      .__   __. .___________. __  ___   ___  //
+//      /       | /      ||  |     /   \     |  \ |  | |           ||  | \  \ /  /  //
+//     |   (----`|  ,----'|  |    /  ^  \    |   \|  | `---|  |----`|  |  \  V  /   //
+//      \   \    |  |     |  |   /  /_\  \   |  . `  |     |  |     |  |   >   <    //
+//  .----)   |   |  `----.|  |  /  _____  \  |  |\   |     |  |     |  |  /  .  \   //
+//  |_______/     \______||__| /__/     \__\ |__| \__|     |__|     |__| /__/ \__\  //
+//                                                                                  //
+//  Originally developed by D. Pizzocri & T. Barani                                 //
+//                                                                                  //
+//  Version: 2.0                                                                    //
+//  Year: 2022                                                                      //
+//  Authors: D. Pizzocri, G. Zullo.                                                 //
+//                                                                                  //
+//////////////////////////////////////////////////////////////////////////////////////
+
+/// StepperTest
+/// Test of SimulationStepper: each case of the regression database given in the command line is run once with RunSimulation,
+/// and once by a host advancing a SimulationStepper in increments of time (advanceTo) that do not match the time steps.
+/// The test checks that the output.txt of the two simulations are the same, bit for bit.
+/// The input files of each case are copied in <work directory>/<case>/full and <work directory>/<case>/stepped,
+/// where the files of the two simulations are written.
+/// The executable returns 1 if a case fails, so it can be run by ctest.
+///
+/// Usage: sciantix_stepper_test <work directory> <case directory> [<case directory> ...]
+
+#include "RunSimulation.h"
+#include <filesystem>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+static std::string SimulationDirectory(const std::filesystem::path& case_directory, const std::filesystem::path& directory)
+{
+	std::filesystem::remove_all(directory);
+	std::filesystem::create_directories(directory);
+	for (const std::filesystem::directory_entry& file : std::filesystem::directory_iterator(case_directory))
+		if (file.path().filename().string().rfind("input_", 0) == 0)
+			std::filesystem::copy_file(file.path(), directory / file.path().filename());
+
+	return directory.string() + "/";
+}
+
+static std::string FileContent(const std::string& file_name)
+{
+	std::ifstream file(file_name);
+	std::stringstream content;
+	content << file.rdbuf();
+	return content.str();
+}
+
+static bool StepperCase(const std::string& case_directory, const std::string& work_directory)
+{
+	const std::string name = std::filesystem::path(case_directory).filename().string();
+
+	// Whole simulation at once
+	Simulation_directory = SimulationDirectory(case_directory, std::filesystem::path(work_directory) / name / "full");
+	RunSimulation();
+	const std::string full_output = FileContent(Simulation_directory + "output.txt");
+
+	// The same simulation advanced by a host, in increments of about 1/7 of the history
+	Simulation_directory = SimulationDirectory(case_directory, std::filesystem::path(work_directory) / name / "stepped");
+	int increments(0);
+	{
+		SimulationStepper simulation;
+		const double increment = Time_end_h / 7.0 + 1.0e-3;
+
+		double time_h(0.0);
+		while (simulation.advanceTo(time_h += increment))
+			++increments;
+
+		simulation.finish();
+	}
+	const std::string stepped_output = FileContent(Simulation_directory + "output.txt");
+
+	const bool passed = !full_output.empty() && stepped_output == full_output;
+	std::cout << name << " (" << increments + 1 << " increments): " << (passed ? "PASSED" : "FAILED") << std::endl;
+
+	return passed;
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 3)
+	{
+		std::cerr << "Usage: sciantix_stepper_test <work directory> <case directory> [<case directory> ...]" << std::endl;
+		return 1;
+	}
+
+	std::cout << "SCIANTIX - test of the incremental simulation (SimulationStepper)" << std::endl;
+
+	bool passed(true);
+	for (int i = 2; i < argc; ++i)
+		passed &= StepperCase(argv[i], argv[1]);
+
+	std::cout << "\nStepper test " << (passed ? "PASSED" : "FAILED") << std::endl;
+
+	return passed ? 0 : 1;
+}